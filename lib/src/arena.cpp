@@ -0,0 +1,63 @@
+#include "arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+Arena::Arena(size_t initial_block, std::pmr::memory_resource* upstream)
+    : upstream(upstream), next_block_size(std::max<size_t>(initial_block, 256)) {}
+
+Arena::~Arena() { release(); }
+
+void Arena::release() {
+    for (const Block& block : blocks) {
+        upstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+    }
+    blocks.clear();
+    current = 0;
+    offset = 0;
+}
+
+void Arena::rewind(Marker marker) {
+    current = marker.block;
+    offset = marker.offset;
+}
+
+size_t Arena::used_bytes() const {
+    size_t used = offset;
+    for (size_t i = 0; i < current && i < blocks.size(); ++i) {
+        used += blocks[i].size;
+    }
+    return used;
+}
+
+size_t Arena::capacity() const {
+    size_t total = 0;
+    for (const Block& block : blocks) {
+        total += block.size;
+    }
+    return total;
+}
+
+void* Arena::do_allocate(size_t bytes, size_t alignment) {
+    // сначала уже полученные блоки, в том числе оставшиеся после reset()
+    for (; current < blocks.size(); ++current, offset = 0) {
+        const Block& block = blocks[current];
+        auto base = reinterpret_cast<uintptr_t>(block.data);
+        uintptr_t start = (base + offset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        if (start + bytes <= base + block.size) {
+            offset = start + bytes - base;
+            return reinterpret_cast<void*>(start);
+        }
+    }
+
+    size_t size = std::max(next_block_size, bytes + alignment);
+    next_block_size = size * 2;
+    auto* data = static_cast<std::byte*>(upstream->allocate(size, alignof(std::max_align_t)));
+    blocks.push_back({data, size});
+    current = blocks.size() - 1;
+
+    auto base = reinterpret_cast<uintptr_t>(data);
+    uintptr_t start = (base + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    offset = start + bytes - base;
+    return reinterpret_cast<void*>(start);
+}
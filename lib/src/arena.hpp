@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+// Монотонный распределитель для временных буферов решателей: выделение —
+// сдвиг указателя, освобождение отдельных блоков ничего не делает. reset()
+// и rewind() возвращают указатель назад, но сохраняют полученную от upstream
+// память, поэтому повторные вызовы на графах похожего размера не обращаются
+// к malloc. Совместим с std::pmr-контейнерами.
+class Arena : public std::pmr::memory_resource {
+public:
+    struct Marker {
+        size_t block;
+        size_t offset;
+    };
+
+    explicit Arena(size_t initial_block = 64 << 10,
+                   std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ~Arena() override;
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Всё выделенное становится недействительным, память остаётся у арены.
+    void reset() { rewind({0, 0}); }
+    // Возвращает память upstream.
+    void release();
+
+    Marker mark() const { return {current, offset}; }
+    void rewind(Marker marker);
+
+    size_t used_bytes() const;
+    size_t capacity() const;
+
+private:
+    struct Block {
+        std::byte* data;
+        size_t size;
+    };
+
+    std::pmr::memory_resource* upstream;
+    std::vector<Block> blocks;
+    size_t next_block_size;
+    size_t current = 0;
+    size_t offset = 0;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Область временных данных решателя: всё, что выделено из арены за время её
+// жизни, освобождается при выходе. Без арены память берётся из кучи.
+class ScratchScope {
+public:
+    explicit ScratchScope(Arena* arena) : arena(arena), marker(arena ? arena->mark() : Arena::Marker{0, 0}) {}
+    ~ScratchScope() {
+        if (arena) arena->rewind(marker);
+    }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    std::pmr::memory_resource* resource() const {
+        return arena ? static_cast<std::pmr::memory_resource*>(arena) : std::pmr::get_default_resource();
+    }
+
+private:
+    Arena* arena;
+    Arena::Marker marker;
+};
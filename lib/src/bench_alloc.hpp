@@ -0,0 +1,138 @@
+#pragma once
+
+// Подсчёт выделенной памяти для бенчмарков. Заменяет глобальные operator new
+// и operator delete, поэтому подключается ровно в одну единицу трансляции
+// программы (src/bench.cpp задачи) и больше никуда.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+inline std::atomic<size_t> g_bench_allocated_bytes{0};
+inline std::atomic<size_t> g_bench_allocations{0};
+
+// Все формы new и delete идут через эту пару. Она не встраивается: иначе
+// GCC видит free() на указателе из operator new и предупреждает
+// -Wmismatched-new-delete.
+[[gnu::noinline]] inline void* bench_allocate(size_t size, size_t alignment) noexcept {
+    g_bench_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    g_bench_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (alignment <= alignof(std::max_align_t)) return std::malloc(size == 0 ? 1 : size);
+    size_t rounded = (size + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded);
+}
+
+[[gnu::noinline]] inline void bench_release(void* p) noexcept {
+    std::free(p);
+}
+
+inline void* bench_allocate_or_throw(size_t size, size_t alignment) {
+    if (void* p = bench_allocate(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size) {
+    return bench_allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+void* operator new[](size_t size) {
+    return bench_allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return bench_allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return bench_allocate(size, alignof(std::max_align_t));
+}
+
+// std::pmr::new_delete_resource() выделяет через выровненные версии
+void* operator new(size_t size, std::align_val_t align) {
+    return bench_allocate_or_throw(size, static_cast<size_t>(align));
+}
+
+void* operator new[](size_t size, std::align_val_t align) {
+    return bench_allocate_or_throw(size, static_cast<size_t>(align));
+}
+
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return bench_allocate(size, static_cast<size_t>(align));
+}
+
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return bench_allocate(size, static_cast<size_t>(align));
+}
+
+void operator delete(void* p) noexcept {
+    bench_release(p);
+}
+
+void operator delete[](void* p) noexcept {
+    bench_release(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    bench_release(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    bench_release(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    bench_release(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    bench_release(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    bench_release(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    bench_release(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept {
+    bench_release(p);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept {
+    bench_release(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    bench_release(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    bench_release(p);
+}
+
+// Замеряет выделения внутри цикла бенчмарка и пишет их в счётчики
+// bytes_alloc / allocs (в среднем на итерацию).
+class AllocationCounter {
+public:
+    explicit AllocationCounter(benchmark::State& state)
+        : state(state),
+          start_bytes(g_bench_allocated_bytes.load()),
+          start_count(g_bench_allocations.load()) {}
+
+    ~AllocationCounter() {
+        double bytes = static_cast<double>(g_bench_allocated_bytes.load() - start_bytes);
+        double count = static_cast<double>(g_bench_allocations.load() - start_count);
+        state.counters["bytes_alloc"] = benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+        state.counters["allocs"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& state;
+    size_t start_bytes;
+    size_t start_count;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+// Система непересекающихся множеств для одновременных unite/find из разных
+// потоков без блокировок: корень с большим номером подвешивается к меньшему
+// через compare_exchange, пути сокращаются делением пополам. Какое из
+// одновременных объединений «победит», зависит от планировщика, но итоговое
+// разбиение на множества — нет.
+class ConcurrentUnionFind {
+public:
+    ConcurrentUnionFind() = default;
+    explicit ConcurrentUnionFind(int n) : n(n), parent(std::make_unique<std::atomic<int>[]>(n)) {
+        for (int v = 0; v < n; ++v) {
+            parent[v].store(v, std::memory_order_relaxed);
+        }
+    }
+
+    int size() const { return n; }
+
+    int find(int v) const {
+        while (true) {
+            int p = parent[v].load(std::memory_order_acquire);
+            if (p == v) return v;
+            int grand = parent[p].load(std::memory_order_acquire);
+            if (grand != p) {
+                parent[v].compare_exchange_weak(p, grand, std::memory_order_acq_rel);
+            }
+            v = grand;
+        }
+    }
+
+    // true, если a и b были в разных множествах и этот вызов их объединил.
+    bool unite(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (a < b) std::swap(a, b);
+            int expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) return true;
+        }
+    }
+
+    bool same(int a, int b) const {
+        // корень мог смениться между двумя find: повторяем, пока a — корень
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return true;
+            if (parent[a].load(std::memory_order_acquire) == a) return false;
+        }
+    }
+
+private:
+    int n = 0;
+    std::unique_ptr<std::atomic<int>[]> parent;
+};
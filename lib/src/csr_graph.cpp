@@ -0,0 +1,258 @@
+#include "csr_graph.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "parallel.hpp"
+
+namespace {
+
+// Меньше рёбер на поток не окупают запуск потоков и атомарные счётчики.
+constexpr int kMinEdgesPerThread = 1 << 16;
+
+template <class Weight>
+void check_weights(const EdgeList& edges) {
+    if (sizeof(Weight) >= sizeof(long long) || edges.weights.empty()) return;
+    auto [lo, hi] = std::minmax_element(edges.weights.begin(), edges.weights.end());
+    if (*lo < std::numeric_limits<Weight>::min() || *hi > std::numeric_limits<Weight>::max()) {
+        throw std::overflow_error("edge weight does not fit graph weight type (build with -DGRAPH_WIDE_WEIGHTS=ON)");
+    }
+}
+
+}  // namespace
+
+template <class Vertex, class Weight>
+BasicCSRGraph<Vertex, Weight> BasicCSRGraph<Vertex, Weight>::adopt(int n, bool directed,
+                                                                   std::shared_ptr<Storage> data) {
+    BasicCSRGraph g;
+    g.n = n;
+    g.is_directed = directed;
+    g.offsets_ = data->offsets;
+    g.targets_ = data->targets;
+    g.weights_ = data->weights;
+    g.edge_ids_ = data->edge_ids;
+    g.storage = std::move(data);
+    return g;
+}
+
+template <class Vertex, class Weight>
+BasicCSRGraph<Vertex, Weight> BasicCSRGraph<Vertex, Weight>::view(int n, bool directed,
+                                                                  std::span<const Vertex> offsets,
+                                                                  std::span<const Vertex> targets,
+                                                                  std::span<const Weight> weights,
+                                                                  std::shared_ptr<const void> owner) {
+    BasicCSRGraph g;
+    g.n = n;
+    g.is_directed = directed;
+    g.offsets_ = offsets;
+    g.targets_ = targets;
+    g.weights_ = weights;
+    g.storage = std::move(owner);
+    return g;
+}
+
+template <class Vertex, class Weight>
+BasicCSRGraph<Vertex, Weight> BasicCSRGraph<Vertex, Weight>::from_edges(const EdgeList& edges, bool directed,
+                                                                        bool with_edge_ids, unsigned threads) {
+    check_weights<Weight>(edges);
+    int n = edges.n;
+    int m = edges.size();
+    bool weighted = edges.weighted();
+    int arcs = directed ? m : 2 * m;
+
+    auto data = std::make_shared<Storage>();
+    data->offsets.assign(n + 1, 0);
+    data->targets.resize(arcs);
+    if (weighted) data->weights.resize(arcs);
+    if (with_edge_ids) data->edge_ids.resize(arcs);
+
+    std::vector<Vertex>& offsets = data->offsets;
+    auto place_into = [&](std::vector<Vertex>& pos, int u, int v, int id) {
+        Vertex p = pos[u]++;
+        data->targets[p] = v;
+        if (weighted) data->weights[p] = edges.weights[id];
+        if (with_edge_ids) data->edge_ids[p] = id;
+    };
+
+    unsigned parts = std::min<unsigned>(threads, m / kMinEdgesPerThread);
+    if (parts > 1) {
+        // Степени — атомарными прибавлениями в один массив, а не счётчиками
+        // на каждый кусок: память O(n), а не O(threads * n). Дуги тоже
+        // раскладываются атомарно, и порядок в списке соседей зависит от
+        // потоков, поэтому на время раскладки targets хранит номер дуги
+        // (i или 2i + сторона для неориентированного). Список сортируется по
+        // нему, и номера заменяются концами: порядок как в одном потоке.
+        parallel_blocks(m, parts, [&](unsigned, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                std::atomic_ref<Vertex>(offsets[edges.from[i] + 1]).fetch_add(1, std::memory_order_relaxed);
+                if (!directed) std::atomic_ref<Vertex>(offsets[edges.to[i] + 1]).fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        for (int v = 0; v < n; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<Vertex> pos(offsets.begin(), offsets.end() - 1);
+        std::vector<Vertex>& targets = data->targets;
+        parallel_blocks(m, parts, [&](unsigned, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                Vertex arc = directed ? i : 2 * i;
+                targets[std::atomic_ref<Vertex>(pos[edges.from[i]]).fetch_add(1, std::memory_order_relaxed)] = arc;
+                if (!directed) {
+                    targets[std::atomic_ref<Vertex>(pos[edges.to[i]]).fetch_add(1, std::memory_order_relaxed)] = arc + 1;
+                }
+            }
+        });
+        parallel_vertex_blocks(offsets, parts, [&](unsigned, int begin, int end) {
+            for (int v = begin; v < end; ++v) {
+                auto first = targets.begin() + offsets[v];
+                auto last = targets.begin() + offsets[v + 1];
+                if (!std::is_sorted(first, last)) std::sort(first, last);
+                for (Vertex p = offsets[v]; p < offsets[v + 1]; ++p) {
+                    Vertex arc = targets[p];
+                    int id = directed ? arc : arc / 2;
+                    targets[p] = directed || arc % 2 == 0 ? edges.to[id] : edges.from[id];
+                    if (weighted) data->weights[p] = edges.weights[id];
+                    if (with_edge_ids) data->edge_ids[p] = id;
+                }
+            }
+        });
+        return adopt(n, directed, std::move(data));
+    }
+
+    for (int i = 0; i < m; ++i) {
+        offsets[edges.from[i] + 1]++;
+        if (!directed) offsets[edges.to[i] + 1]++;
+    }
+    for (int v = 0; v < n; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    std::vector<Vertex> pos(offsets.begin(), offsets.end() - 1);
+    for (int i = 0; i < m; ++i) {
+        place_into(pos, edges.from[i], edges.to[i], i);
+        if (!directed) place_into(pos, edges.to[i], edges.from[i], i);
+    }
+
+    return adopt(n, directed, std::move(data));
+}
+
+template <class Vertex, class Weight>
+BasicCSRGraph<Vertex, Weight> BasicCSRGraph<Vertex, Weight>::transpose(unsigned threads) const {
+    if (!is_directed) return *this;
+
+    auto data = std::make_shared<Storage>();
+    data->offsets.assign(n + 1, 0);
+    data->targets.resize(targets_.size());
+    if (has_weights()) data->weights.resize(weights_.size());
+    if (has_edge_ids()) data->edge_ids.resize(edge_ids_.size());
+
+    auto place_from = [&](std::vector<Vertex>& pos, int begin, int end) {
+        for (int u = begin; u < end; ++u) {
+            for (Vertex i = offsets_[u]; i < offsets_[u + 1]; ++i) {
+                Vertex p = pos[targets_[i]]++;
+                data->targets[p] = u;
+                if (has_weights()) data->weights[p] = weights_[i];
+                if (has_edge_ids()) data->edge_ids[p] = edge_ids_[i];
+            }
+        }
+    };
+
+    unsigned parts = std::min<unsigned>(threads, targets_.size() / kMinEdgesPerThread);
+    if (parts > 1) {
+        // Как в from_edges: степени и раскладка атомарно в общие массивы.
+        // Дуги из одной вершины раскладывает один поток по возрастанию,
+        // поэтому устойчивая сортировка списка по началу дуги (вместе с
+        // весами и номерами рёбер) даёт порядок одного потока.
+        std::vector<Vertex>& offsets = data->offsets;
+        parallel_vertex_blocks(offsets_, parts, [&](unsigned, int begin, int end) {
+            for (Vertex i = offsets_[begin]; i < offsets_[end]; ++i) {
+                std::atomic_ref<Vertex>(offsets[targets_[i] + 1]).fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        for (int v = 0; v < n; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<Vertex> pos(offsets.begin(), offsets.end() - 1);
+        parallel_vertex_blocks(offsets_, parts, [&](unsigned, int begin, int end) {
+            for (int u = begin; u < end; ++u) {
+                for (Vertex i = offsets_[u]; i < offsets_[u + 1]; ++i) {
+                    Vertex p = std::atomic_ref<Vertex>(pos[targets_[i]]).fetch_add(1, std::memory_order_relaxed);
+                    data->targets[p] = u;
+                    if (has_weights()) data->weights[p] = weights_[i];
+                    if (has_edge_ids()) data->edge_ids[p] = edge_ids_[i];
+                }
+            }
+        });
+        parallel_vertex_blocks(offsets, parts, [&](unsigned, int begin, int end) {
+            std::vector<Vertex> order;
+            std::vector<Vertex> sources;
+            std::vector<Weight> weights;
+            std::vector<Vertex> ids;
+            for (int v = begin; v < end; ++v) {
+                Vertex* first = data->targets.data() + offsets[v];
+                Vertex degree = offsets[v + 1] - offsets[v];
+                if (std::is_sorted(first, first + degree)) continue;
+                if (!has_weights() && !has_edge_ids()) {
+                    // одинаковые начала неразличимы
+                    std::sort(first, first + degree);
+                    continue;
+                }
+                order.resize(degree);
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(), [&](Vertex a, Vertex b) { return first[a] < first[b]; });
+                auto permute = [&](auto* values, auto& scratch) {
+                    scratch.assign(values, values + degree);
+                    for (Vertex k = 0; k < degree; ++k) values[k] = scratch[order[k]];
+                };
+                permute(first, sources);
+                if (has_weights()) permute(data->weights.data() + offsets[v], weights);
+                if (has_edge_ids()) permute(data->edge_ids.data() + offsets[v], ids);
+            }
+        });
+        return adopt(n, true, std::move(data));
+    }
+
+    for (Vertex v : targets_) {
+        data->offsets[v + 1]++;
+    }
+    for (int v = 0; v < n; ++v) {
+        data->offsets[v + 1] += data->offsets[v];
+    }
+
+    std::vector<Vertex> pos(data->offsets.begin(), data->offsets.end() - 1);
+    place_from(pos, 0, n);
+
+    return adopt(n, true, std::move(data));
+}
+
+template <class Vertex, class Weight>
+EdgeList BasicCSRGraph<Vertex, Weight>::to_edge_list() const {
+    EdgeList edges(n);
+    int m = is_directed ? arc_count() : arc_count() / 2;
+    edges.reserve(m);
+    if (has_weights()) edges.weights.reserve(m);
+    for (int u = 0; u < n; ++u) {
+        // у петли неориентированного графа берём каждую вторую копию
+        bool loop_copy = false;
+        for (Vertex i = offsets_[u]; i < offsets_[u + 1]; ++i) {
+            int v = targets_[i];
+            if (!is_directed && v < u) continue;
+            if (!is_directed && v == u) {
+                loop_copy = !loop_copy;
+                if (loop_copy) continue;
+            }
+            if (has_weights()) {
+                edges.add(u, v, weights_[i]);
+            } else {
+                edges.add(u, v);
+            }
+        }
+    }
+    return edges;
+}
+
+template class BasicCSRGraph<uint32_t, int32_t>;
+template class BasicCSRGraph<uint32_t, int64_t>;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "edge_list.hpp"
+
+// Граф в формате CSR: смещения offsets (n + 1) и подряд лежащие списки
+// смежности targets. Веса (или пропускные способности) и номера исходных
+// рёбер хранятся параллельно targets и могут отсутствовать.
+// Данные неизменяемы и разделяются между копиями.
+//
+// Vertex — тип номеров вершин, смещений и номеров рёбер, Weight — тип веса
+// дуги. Узкие типы вдвое уменьшают объём, который обход читает из памяти;
+// суммы весов решатели всё равно считают в long long.
+template <class Vertex, class Weight>
+class BasicCSRGraph {
+public:
+    using vertex_type = Vertex;
+    using weight_type = Weight;
+
+    BasicCSRGraph() = default;
+
+    // Сортировка подсчётом по началу дуги. Порядок соседей совпадает с
+    // порядком добавления рёбер. Для неориентированного графа каждое ребро
+    // даёт две дуги; with_edge_ids сохраняет для дуги номер ребра в списке.
+    // При threads > 1 подсчёт степеней и раскладка идут по кускам списка
+    // рёбер параллельно через атомарные счётчики (дополнительная память
+    // O(n)); списки соседей затем упорядочиваются, и результат тот же, что
+    // и в одном потоке.
+    // Бросает std::overflow_error, если вес не помещается в Weight.
+    static BasicCSRGraph from_edges(const EdgeList& edges, bool directed, bool with_edge_ids = false,
+                                    unsigned threads = 1);
+
+    // Граф поверх чужой памяти (например, отображённого файла) без копирования;
+    // owner продлевает жизнь этой памяти.
+    static BasicCSRGraph view(int n, bool directed, std::span<const Vertex> offsets,
+                              std::span<const Vertex> targets, std::span<const Weight> weights,
+                              std::shared_ptr<const void> owner);
+
+    int vertex_count() const { return n; }
+    int arc_count() const { return static_cast<int>(targets_.size()); }
+    bool directed() const { return is_directed; }
+    bool has_weights() const { return !weights_.empty(); }
+    bool has_edge_ids() const { return !edge_ids_.empty(); }
+
+    int degree(int v) const { return offsets_[v + 1] - offsets_[v]; }
+
+    std::span<const Vertex> neighbors(int v) const {
+        return targets_.subspan(offsets_[v], degree(v));
+    }
+
+    std::span<const Weight> neighbor_weights(int v) const {
+        return weights_.subspan(offsets_[v], degree(v));
+    }
+
+    std::span<const Vertex> offsets() const { return offsets_; }
+    std::span<const Vertex> targets() const { return targets_; }
+    std::span<const Weight> weights() const { return weights_; }
+    std::span<const Vertex> edge_ids() const { return edge_ids_; }
+
+    // Граф с обращёнными дугами (для неориентированного совпадает с исходным).
+    // При threads > 1 исходные вершины делятся на куски с равным числом дуг,
+    // счётчики общие и атомарные, как в from_edges; порядок соседей тот же,
+    // что в одном потоке.
+    BasicCSRGraph transpose(unsigned threads = 1) const;
+
+    // Обратно в список рёбер (с весами, если они есть) в порядке CSR.
+    // Неориентированное ребро выдаётся один раз, как (u, v) с u < v;
+    // петля — тоже один раз, хотя в CSR она лежит дважды.
+    EdgeList to_edge_list() const;
+
+private:
+    struct Storage {
+        std::vector<Vertex> offsets;
+        std::vector<Vertex> targets;
+        std::vector<Weight> weights;
+        std::vector<Vertex> edge_ids;
+    };
+
+    int n = 0;
+    bool is_directed = true;
+    std::span<const Vertex> offsets_;
+    std::span<const Vertex> targets_;
+    std::span<const Weight> weights_;
+    std::span<const Vertex> edge_ids_;
+    std::shared_ptr<const void> storage;
+
+    static BasicCSRGraph adopt(int n, bool directed, std::shared_ptr<Storage> data);
+};
+
+// Реализация в csr_graph.cpp, там же явные инстанцирования.
+extern template class BasicCSRGraph<uint32_t, int32_t>;
+extern template class BasicCSRGraph<uint32_t, int64_t>;
+
+// Ширина весов выбирается при сборке: по умолчанию 32 бита,
+// -DGRAPH_WIDE_WEIGHTS=ON — 64 бита для входов с большими весами.
+#if GRAPH_WIDE_WEIGHTS
+using graph_weight_t = int64_t;
+#else
+using graph_weight_t = int32_t;
+#endif
+
+using CSRGraph = BasicCSRGraph<uint32_t, graph_weight_t>;
+
+// Граф с 64-битными весами при любой сборке: для решателей, у которых
+// отдельный вес (а не только сумма) может не поместиться в 32 бита.
+using WideCSRGraph = BasicCSRGraph<uint32_t, int64_t>;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+// Обработчик событий обхода по умолчанию: от него наследуются, переопределяя
+// только нужные методы. Методы вызываются напрямую (без виртуальности) и
+// встраиваются компилятором.
+struct DfsVisitor {
+    // Вершина v впервые достигнута из parent (-1 для корня).
+    void enter(int /*v*/, int /*parent*/) {}
+    // Обход поддерева child завершён, возврат по дуге v -> child.
+    void tree_edge(int /*v*/, int /*child*/) {}
+    // Дуга v -> to в уже достигнутую вершину; on_stack — to ещё не покинута
+    // (для ориентированного графа это обратная дуга, т.е. цикл).
+    void non_tree_edge(int /*v*/, int /*to*/, bool /*on_stack*/) {}
+    // Все дуги v просмотрены.
+    void leave(int /*v*/, int /*parent*/) {}
+    // true прерывает обход после текущего события.
+    bool stop() const { return false; }
+};
+
+// Обход в глубину на явном стеке вместо рекурсии: глубина ограничена только
+// памятью, стек выделяется один раз на n вершин и переиспользуется.
+// Состояние вершин сохраняется между вызовами run до reset, поэтому лес
+// обходится циклом по корням с проверкой visited.
+class DfsEngine {
+public:
+    enum State : uint8_t { kWhite = 0, kGrey = 1, kBlack = 2 };
+
+    DfsEngine() = default;
+    explicit DfsEngine(int n) { reset(n); }
+    // Стек и цвета берутся из resource (например, из Arena).
+    explicit DfsEngine(std::pmr::memory_resource* resource) : owned(resource), stack(resource) {}
+    // Цвета в чужом массиве (kWhite для непосещённых), общем для нескольких
+    // движков: так потоки обходят непересекающиеся части графа без n байт
+    // цветов на поток. Стек не резервируется, см. reserve_stack.
+    explicit DfsEngine(std::span<uint8_t> shared_colors) : shared(shared_colors.data()) {}
+
+    void reset(int n) {
+        owned.assign(n, kWhite);
+        shared = nullptr;
+        stack.clear();
+        stack.reserve(n);
+    }
+
+    // Обходу части из vertices вершин хватит стека на столько кадров.
+    void reserve_stack(size_t vertices) { stack.reserve(vertices); }
+
+    bool visited(int v) const { return colors()[v] != kWhite; }
+    State color(int v) const { return static_cast<State>(colors()[v]); }
+
+    // Обходит всё, что достижимо из root. Graph — CSR с offsets() и targets().
+    // Возвращает false, если обход прерван visitor.stop().
+    template <class Graph, class Visitor>
+    bool run(const Graph& graph, int root, Visitor& visitor) {
+        auto offsets = graph.offsets();
+        auto targets = graph.targets();
+        uint8_t* state = colors();
+
+        state[root] = kGrey;
+        visitor.enter(root, -1);
+        if (visitor.stop()) return abort();
+        stack.push_back({root, -1, offsets[root]});
+
+        while (!stack.empty()) {
+            Frame& top = stack.back();
+            int v = top.v;
+            if (top.pos < offsets[v + 1]) {
+                int to = targets[top.pos++];
+                if (state[to] == kWhite) {
+                    state[to] = kGrey;
+                    visitor.enter(to, v);
+                    stack.push_back({to, v, offsets[to]});
+                } else {
+                    visitor.non_tree_edge(v, to, state[to] == kGrey);
+                }
+            } else {
+                int parent = top.parent;
+                state[v] = kBlack;
+                stack.pop_back();
+                visitor.leave(v, parent);
+                if (parent != -1) visitor.tree_edge(parent, v);
+            }
+            if (visitor.stop()) return abort();
+        }
+        return true;
+    }
+
+private:
+    struct Frame {
+        int v;
+        int parent;
+        uint32_t pos;  // следующая непросмотренная дуга в targets
+    };
+
+    std::pmr::vector<uint8_t> owned;
+    uint8_t* shared = nullptr;
+    std::pmr::vector<Frame> stack;
+
+    uint8_t* colors() { return shared ? shared : owned.data(); }
+    const uint8_t* colors() const { return shared ? shared : owned.data(); }
+
+    bool abort() {
+        stack.clear();
+        return false;
+    }
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdlib>
+#include <string_view>
+
+#include "fast_writer.hpp"
+#include "parallel.hpp"
+#include "solver_stats.hpp"
+
+// Общие флаги драйверов задач:
+//   --graph <file>  граф из бинарного файла (tools/graph_convert) вместо stdin
+//   --stream <file> текстовый вход, который не помещается в память, читается
+//                   с диска в несколько проходов (где драйвер это умеет)
+//   --stats         после ответа вывести в stderr статистику решателя (JSON)
+//   --threads <k>   потоки для чтения входа, построения CSR и параллельных
+//                   решателей (0 — все ядра)
+struct DriverArgs {
+    const char* graph_path = nullptr;
+    const char* stream_path = nullptr;
+    bool print_stats = false;
+    unsigned threads = 0;
+
+    DriverArgs(int argc, char* argv[]) {
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            if (arg == "--graph" && i + 1 < argc) {
+                graph_path = argv[++i];
+            } else if (arg == "--stream" && i + 1 < argc) {
+                stream_path = argv[++i];
+            } else if (arg == "--stats") {
+                print_stats = true;
+            } else if (arg == "--threads" && i + 1 < argc) {
+                threads = std::atoi(argv[++i]);
+            }
+        }
+        if (threads == 0) threads = default_thread_count();
+    }
+
+    void dump_stats(const SolverStats& stats) const {
+        if (!print_stats) return;
+        FastWriter err(2);
+        stats.write_json(err);
+    }
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+// Плоский список рёбер (structure of arrays), из которого строится CSRGraph.
+struct EdgeList {
+    int n = 0;
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<long long> weights;  // пустой, если граф невзвешенный
+
+    EdgeList() = default;
+    explicit EdgeList(int vertices) : n(vertices) {}
+
+    void add(int u, int v) {
+        from.push_back(u);
+        to.push_back(v);
+    }
+
+    void add(int u, int v, long long w) {
+        from.push_back(u);
+        to.push_back(v);
+        weights.push_back(w);
+    }
+
+    void reserve(int m) {
+        from.reserve(m);
+        to.reserve(m);
+    }
+
+    void clear() {
+        from.clear();
+        to.clear();
+        weights.clear();
+    }
+
+    int size() const { return static_cast<int>(from.size()); }
+    bool empty() const { return from.empty(); }
+    bool weighted() const { return !weights.empty(); }
+};
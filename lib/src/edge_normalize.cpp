@@ -0,0 +1,96 @@
+#include "edge_normalize.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// 2^11 счётчиков занимают 16 КБ и остаются в L1
+constexpr int kDigitBits = 11;
+constexpr uint64_t kDigitMask = (1u << kDigitBits) - 1;
+
+// Сортирует ключи из key_bits младших бит; проходы, в которых у всех ключей
+// одна и та же цифра, пропускаются.
+void radix_sort(std::vector<uint64_t>& keys, int key_bits) {
+    std::vector<uint64_t> buffer(keys.size());
+    for (int shift = 0; shift < key_bits; shift += kDigitBits) {
+        std::array<size_t, kDigitMask + 1> count{};
+        for (uint64_t key : keys) {
+            count[(key >> shift) & kDigitMask]++;
+        }
+        if (count[(keys[0] >> shift) & kDigitMask] == keys.size()) continue;
+
+        size_t pos = 0;
+        for (size_t& c : count) {
+            size_t next = pos + c;
+            c = pos;
+            pos = next;
+        }
+        for (uint64_t key : keys) {
+            buffer[count[(key >> shift) & kDigitMask]++] = key;
+        }
+        keys.swap(buffer);
+    }
+}
+
+// Число бит на номер вершины в упакованном ключе.
+int vertex_bits(const EdgeList& edges) {
+    return std::max(1, static_cast<int>(std::bit_width(static_cast<uint32_t>(std::max(edges.n, 1) - 1))));
+}
+
+// Ключи (u << bits) | v: сортирует, убирает повторы и
+// раскладывает обратно в edges.
+void unpack_unique(EdgeList& edges, std::vector<uint64_t>& keys, int bits) {
+    if (keys.empty()) return;
+
+    radix_sort(keys, 2 * bits);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    uint64_t mask = (uint64_t(1) << bits) - 1;
+    edges.from.resize(keys.size());
+    edges.to.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        edges.from[i] = static_cast<int>(keys[i] >> bits);
+        edges.to[i] = static_cast<int>(keys[i] & mask);
+    }
+}
+
+}  // namespace
+
+void normalize_undirected(EdgeList& edges) {
+    edges.weights.clear();
+    if (edges.empty()) return;
+
+    // ключ (min << bits) | max: порядок ключей — порядок пар
+    int bits = vertex_bits(edges);
+    std::vector<uint64_t> keys;
+    keys.reserve(edges.size());
+    for (int i = 0; i < edges.size(); ++i) {
+        uint64_t u = edges.from[i];
+        uint64_t v = edges.to[i];
+        if (u == v) continue;
+        if (u > v) std::swap(u, v);
+        keys.push_back(u << bits | v);
+    }
+    edges.clear();
+    unpack_unique(edges, keys, bits);
+}
+
+void normalize_directed(EdgeList& edges) {
+    edges.weights.clear();
+    if (edges.empty()) return;
+
+    int bits = vertex_bits(edges);
+    std::vector<uint64_t> keys;
+    keys.reserve(edges.size());
+    for (int i = 0; i < edges.size(); ++i) {
+        uint64_t u = edges.from[i];
+        uint64_t v = edges.to[i];
+        if (u != v) keys.push_back(u << bits | v);
+    }
+    edges.clear();
+    unpack_unique(edges, keys, bits);
+}
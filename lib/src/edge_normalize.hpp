@@ -0,0 +1,14 @@
+#pragma once
+
+#include "edge_list.hpp"
+
+// Приводит неориентированный невзвешенный список рёбер к простому графу:
+// каждое ребро записано как u < v, петли и повторы удалены, рёбра идут по
+// возрастанию (u, v). Вместо дерева пар — поразрядная (LSD) сортировка
+// упакованных 64-битных ключей: O(m) без выделения памяти на каждое ребро.
+// Веса, если были, отбрасываются.
+void normalize_undirected(EdgeList& edges);
+
+// То же для ориентированного графа: дуга u -> v остаётся как есть, петли и
+// повторы дуг удаляются, дуги идут по возрастанию (u, v).
+void normalize_directed(EdgeList& edges);
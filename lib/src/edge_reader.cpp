@@ -0,0 +1,140 @@
+#include "edge_reader.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "parallel.hpp"
+
+namespace {
+
+// Меньшие входы быстрее прочитать одним потоком.
+constexpr long long kParallelMinEdges = 1 << 18;
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+const char* line_end(const char* p, const char* end) {
+    const void* found = std::memchr(p, '\n', end - p);
+    return found ? static_cast<const char*>(found) : end;
+}
+
+// true, если в строке есть что-то кроме пробелов
+bool has_content(const char* p, const char* eol) {
+    while (p < eol && is_space(*p)) ++p;
+    return p < eol;
+}
+
+// Число в пределах строки; false, если строка кончилась раньше.
+bool parse_number(const char*& p, const char* eol, long long& out) {
+    while (p < eol && is_space(*p)) ++p;
+    if (p == eol) return false;
+    bool negative = *p == '-';
+    p += negative;
+    unsigned long long value = 0;
+    const char* start = p;
+    while (p < eol) {
+        unsigned digit = static_cast<unsigned char>(*p) - '0';
+        if (digit > 9) break;
+        value = value * 10 + digit;
+        ++p;
+    }
+    if (p == start) return false;
+    long long result = static_cast<long long>(value);
+    out = negative ? -result : result;
+    return true;
+}
+
+bool read_parallel(FastReader& in, EdgeList& edges, long long m, bool weighted, unsigned threads) {
+    std::string_view text = in.remaining();
+    const char* base = text.data();
+    const char* text_end = base + text.size();
+
+    // куски начинаются с начала строки
+    std::vector<const char*> bounds(threads + 1, text_end);
+    bounds[0] = base;
+    for (unsigned part = 1; part < threads; ++part) {
+        const char* p = std::max(base + text.size() * part / threads, bounds[part - 1]);
+        if (p > base && p < text_end && p[-1] != '\n') {
+            p = line_end(p, text_end);
+            if (p < text_end) ++p;
+        }
+        bounds[part] = p;
+    }
+
+    std::vector<long long> first(threads + 1, 0);
+    parallel_blocks(threads, threads, [&](unsigned part, size_t, size_t) {
+        long long lines = 0;
+        for (const char* p = bounds[part]; p < bounds[part + 1];) {
+            const char* eol = line_end(p, bounds[part + 1]);
+            lines += has_content(p, eol);
+            p = eol + 1;
+        }
+        first[part + 1] = lines;
+    });
+    for (unsigned part = 0; part < threads; ++part) {
+        first[part + 1] += first[part];
+    }
+    if (first[threads] < m) return false;
+
+    edges.from.resize(m);
+    edges.to.resize(m);
+    if (weighted) edges.weights.resize(m);
+
+    std::atomic<bool> malformed{false};
+    const char* edges_end = text_end;
+    parallel_blocks(threads, threads, [&](unsigned part, size_t, size_t) {
+        long long index = first[part];
+        for (const char* p = bounds[part]; p < bounds[part + 1] && index < m;) {
+            const char* eol = line_end(p, bounds[part + 1]);
+            if (has_content(p, eol)) {
+                long long u = 0, v = 0, w = 0;
+                const char* q = p;
+                bool ok = parse_number(q, eol, u) && parse_number(q, eol, v) && (!weighted || parse_number(q, eol, w));
+                if (!ok || has_content(q, eol)) {
+                    malformed = true;
+                    return;
+                }
+                edges.from[index] = u - 1;
+                edges.to[index] = v - 1;
+                if (weighted) edges.weights[index] = w;
+                if (++index == m) edges_end = eol;
+            }
+            p = eol + 1;
+        }
+    });
+    if (malformed) return false;
+
+    in.consume(edges_end - base);
+    return true;
+}
+
+}  // namespace
+
+EdgeList read_edge_list(FastReader& in, int n, long long m, bool weighted, unsigned threads) {
+    if (threads == 0) threads = default_thread_count();
+    threads = std::min<long long>(threads, std::max(1LL, m / kParallelMinEdges));
+
+    EdgeList edges(n);
+    if (threads > 1 && read_parallel(in, edges, m, weighted, threads)) {
+        return edges;
+    }
+
+    // строки не по одному ребру на строку или вход маленький
+    edges = EdgeList(n);
+    edges.reserve(m);
+    if (weighted) edges.weights.reserve(m);
+    for (long long i = 0; i < m; ++i) {
+        int u = in.read_int() - 1;
+        int v = in.read_int() - 1;
+        if (weighted) {
+            edges.add(u, v, in.read_long());
+        } else {
+            edges.add(u, v);
+        }
+    }
+    return edges;
+}
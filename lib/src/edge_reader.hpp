@@ -0,0 +1,13 @@
+#pragma once
+
+#include "edge_list.hpp"
+#include "fast_reader.hpp"
+
+// Читает из in m рёбер "u v" или "u v w" (вершины с 1) и переводит их в
+// нумерацию с 0. Большой вход, где каждое ребро записано на своей строке,
+// разбирается threads потоками (0 — default_thread_count()) прямо из
+// отображённого файла: остаток делится на куски по границам строк, каждый
+// поток считает свои строки, а затем пишет рёбра на их места в общем списке.
+// Порядок рёбер тот же, что при последовательном чтении; после вызова in
+// стоит сразу за последним ребром.
+EdgeList read_edge_list(FastReader& in, int n, long long m, bool weighted, unsigned threads = 0);
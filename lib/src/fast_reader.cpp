@@ -0,0 +1,148 @@
+#include "fast_reader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+FastReader::FastReader(int descriptor) {
+    open(descriptor);
+}
+
+FastReader::FastReader(const char* path) {
+    int descriptor = ::open(path, O_RDONLY);
+    owns_fd = descriptor >= 0;
+    open(descriptor);
+}
+
+FastReader::~FastReader() {
+    if (map_base != nullptr) munmap(map_base, map_size);
+    if (owns_fd) close(fd);
+}
+
+void FastReader::open(int descriptor) {
+    fd = descriptor;
+    if (fd < 0) {
+        eof = true;
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        off_t offset = lseek(fd, 0, SEEK_CUR);
+        if (offset < 0) offset = 0;
+        void* base = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base != MAP_FAILED) {
+            madvise(base, st.st_size, MADV_SEQUENTIAL);
+            map_base = base;
+            map_size = st.st_size;
+            cur = static_cast<const char*>(base) + offset;
+            end = static_cast<const char*>(base) + map_size;
+            eof = true;
+            return;
+        }
+    }
+
+    buffer.resize(kBufferSize);
+    cur = end = buffer.data();
+    refill();
+}
+
+void FastReader::refill() {
+    if (eof) return;
+
+    // непрочитанный хвост переносим в начало буфера
+    size_t tail = end - cur;
+    std::memmove(buffer.data(), cur, tail);
+    char* write_pos = buffer.data() + tail;
+    char* limit = buffer.data() + buffer.size();
+
+    while (write_pos < limit) {
+        ssize_t got = read(fd, write_pos, limit - write_pos);
+        if (got <= 0) {
+            eof = true;
+            break;
+        }
+        write_pos += got;
+        if (write_pos - buffer.data() >= kLookahead) break;
+    }
+
+    cur = buffer.data();
+    end = write_pos;
+}
+
+void FastReader::skip_spaces() {
+    while (true) {
+        if (end - cur < kLookahead) refill();
+        while (cur < end && static_cast<unsigned char>(*cur) <= ' ') ++cur;
+        if (cur < end || eof) return;
+    }
+}
+
+long long FastReader::read_long() {
+    skip_spaces();
+    if (end - cur < kLookahead) refill();
+
+    const char* token = cur;
+    bool negative = cur < end && *cur == '-';
+    cur += negative;
+
+    unsigned long long value = 0;
+    const char* start = cur;
+    while (cur < end) {
+        unsigned digit = static_cast<unsigned char>(*cur) - '0';
+        if (digit > 9) break;
+        value = value * 10 + digit;
+        ++cur;
+    }
+    // за цифрами сразу идёт не пробел ("12abc") — токен тоже не число
+    bool malformed = (cur == start && negative) || (cur < end && static_cast<unsigned char>(*cur) > ' ');
+    // 19 цифр ещё не переполняют unsigned long long
+    unsigned long long limit = negative ? 1ULL << 63 : (1ULL << 63) - 1;
+    bool overflow = cur - start > 19 || value > limit;
+    if (malformed || overflow) {
+        // токен пропускается целиком, иначе следующие вызовы читали бы
+        // на том же месте
+        std::string text(token, std::min<ptrdiff_t>(cur - token, 32));
+        while (true) {
+            while (cur < end && static_cast<unsigned char>(*cur) > ' ') {
+                if (text.size() < 32) text += *cur;
+                ++cur;
+            }
+            if (cur < end || eof) break;
+            refill();
+        }
+        if (malformed) throw std::runtime_error("expected an integer in input, got '" + text + "'");
+        throw std::runtime_error("integer in input does not fit 64 bits: '" + text + "'");
+    }
+
+    return static_cast<long long>(negative ? 0 - value : value);
+}
+
+std::string_view FastReader::remaining() {
+    if (!eof) {
+        size_t tail = end - cur;
+        std::memmove(buffer.data(), cur, tail);
+        size_t size = tail;
+        while (true) {
+            if (size == buffer.size()) buffer.resize(buffer.size() * 2);
+            ssize_t got = read(fd, buffer.data() + size, buffer.size() - size);
+            if (got <= 0) break;
+            size += got;
+        }
+        eof = true;
+        cur = buffer.data();
+        end = buffer.data() + size;
+    }
+    return std::string_view(cur, end - cur);
+}
+
+bool FastReader::at_end() {
+    skip_spaces();
+    return cur >= end;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+// Быстрое чтение целых чисел. Обычный файл (в том числе перенаправленный
+// в stdin) отображается в память через mmap, каналы читаются блоками read().
+class FastReader {
+public:
+    explicit FastReader(int fd = 0);
+    explicit FastReader(const char* path);
+    ~FastReader();
+
+    FastReader(const FastReader&) = delete;
+    FastReader& operator=(const FastReader&) = delete;
+
+    // Бросает std::runtime_error, если очередной токен — не целое число
+    // (в том числе "12abc") или не помещается в long long; сам токен при
+    // этом пропускается. После конца входа возвращает 0.
+    long long read_long();
+    int read_int() { return static_cast<int>(read_long()); }
+
+    // true, если до конца входа остались только пробельные символы
+    bool at_end();
+
+    bool mapped() const { return map_base != nullptr; }
+
+    // Весь непрочитанный остаток входа (канал для этого дочитывается в буфер
+    // до конца). Нужен для разбора несколькими потоками без копирования.
+    std::string_view remaining();
+    // Пропускает count байт остатка, разобранных в обход read_long().
+    void consume(size_t count) { cur += count; }
+
+private:
+    static constexpr size_t kBufferSize = 1 << 20;
+    static constexpr ptrdiff_t kLookahead = 64;
+
+    int fd = -1;
+    bool owns_fd = false;
+    bool eof = false;
+    const char* cur = nullptr;
+    const char* end = nullptr;
+    void* map_base = nullptr;
+    size_t map_size = 0;
+    std::vector<char> buffer;
+
+    void open(int descriptor);
+    void refill();
+    void skip_spaces();
+};
@@ -0,0 +1,43 @@
+#include "fast_writer.hpp"
+
+#include <unistd.h>
+
+#include <cstring>
+
+FastWriter::FastWriter(int descriptor, size_t capacity) : fd(descriptor), buffer(capacity) {
+}
+
+FastWriter::~FastWriter() {
+    flush();
+}
+
+FastWriter& FastWriter::operator<<(std::string_view text) {
+    if (capacity() - size < text.size()) flush();
+    if (text.size() > capacity()) {
+        // слишком длинная строка уходит напрямую, минуя буфер
+        const char* data = text.data();
+        size_t left = text.size();
+        while (left > 0) {
+            ssize_t written = ::write(fd, data, left);
+            if (written <= 0) return *this;
+            data += written;
+            left -= written;
+        }
+        return *this;
+    }
+    std::memcpy(buffer.data() + size, text.data(), text.size());
+    size += text.size();
+    return *this;
+}
+
+void FastWriter::flush() {
+    const char* data = buffer.data();
+    size_t left = size;
+    while (left > 0) {
+        ssize_t written = ::write(fd, data, left);
+        if (written <= 0) break;
+        data += written;
+        left -= written;
+    }
+    size = 0;
+}
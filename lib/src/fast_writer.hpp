@@ -0,0 +1,45 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+// Буферизованный вывод: числа форматируются std::to_chars в общий буфер,
+// который сбрасывается одним write() при заполнении и в деструкторе.
+class FastWriter {
+public:
+    explicit FastWriter(int fd = 1, size_t capacity = 1 << 20);
+    ~FastWriter();
+
+    FastWriter(const FastWriter&) = delete;
+    FastWriter& operator=(const FastWriter&) = delete;
+
+    template <std::integral T>
+    FastWriter& operator<<(T value) {
+        if (capacity() - size < 24) flush();
+        auto [ptr, ec] = std::to_chars(buffer.data() + size, buffer.data() + buffer.size(), value);
+        size = ptr - buffer.data();
+        return *this;
+    }
+
+    FastWriter& operator<<(char c) {
+        if (size == capacity()) flush();
+        buffer[size++] = c;
+        return *this;
+    }
+
+    FastWriter& operator<<(bool value) = delete;
+    FastWriter& operator<<(std::string_view text);
+    FastWriter& operator<<(const char* text) { return *this << std::string_view(text); }
+
+    void flush();
+
+private:
+    int fd;
+    size_t size = 0;
+    std::vector<char> buffer;
+
+    size_t capacity() const { return buffer.size(); }
+};
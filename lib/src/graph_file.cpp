@@ -0,0 +1,209 @@
+#include "graph_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static_assert(std::endian::native == std::endian::little, "graph files are little-endian");
+static_assert(sizeof(GraphFileHeader) == 72);
+
+namespace {
+
+uint64_t align_up(uint64_t pos) {
+    return (pos + graph_file::kAlignment - 1) / graph_file::kAlignment * graph_file::kAlignment;
+}
+
+template <class Weight>
+struct Mapping {
+    void* base = nullptr;
+    size_t size = 0;
+    std::vector<Weight> converted_weights;
+
+    ~Mapping() {
+        if (base != nullptr) munmap(base, size);
+    }
+};
+
+void write_all(int fd, const void* data, size_t size, const char* path) {
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = ::write(fd, ptr, size);
+        if (written <= 0) {
+            close(fd);
+            throw std::runtime_error(std::string("cannot write graph file ") + path);
+        }
+        ptr += written;
+        size -= written;
+    }
+}
+
+void write_padding(int fd, uint64_t& pos, uint64_t target, const char* path) {
+    static const char zeros[graph_file::kAlignment] = {};
+    write_all(fd, zeros, target - pos, path);
+    pos = target;
+}
+
+constexpr uint32_t weight_type_of(size_t size) {
+    return size == sizeof(int32_t) ? graph_file::kInt32Weights : graph_file::kInt64Weights;
+}
+
+size_t weight_size(uint32_t type) {
+    return type == graph_file::kInt32Weights ? sizeof(int32_t) : sizeof(int64_t);
+}
+
+// Веса другой ширины: копия в Weight, живущая вместе с отображением.
+template <class From, class Weight>
+std::span<const Weight> convert_weights(const char* data, uint64_t count, std::vector<Weight>& out,
+                                        const char* path) {
+    const From* src = reinterpret_cast<const From*>(data);
+    out.resize(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        if (src[i] < std::numeric_limits<Weight>::min() || src[i] > std::numeric_limits<Weight>::max()) {
+            throw std::overflow_error(std::string("graph file weights do not fit the graph weight type: ") + path);
+        }
+        out[i] = static_cast<Weight>(src[i]);
+    }
+    return out;
+}
+
+bool valid_csr(int n, std::span<const uint32_t> offsets, std::span<const uint32_t> targets) {
+    if (offsets[0] != 0 || offsets[n] != targets.size()) return false;
+    for (int v = 0; v < n; ++v) {
+        if (offsets[v] > offsets[v + 1]) return false;
+    }
+    return std::all_of(targets.begin(), targets.end(), [n](uint32_t to) { return to < static_cast<uint32_t>(n); });
+}
+
+}  // namespace
+
+template <class Weight>
+void save_graph_file(const char* path, const BasicCSRGraph<uint32_t, Weight>& graph) {
+    GraphFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, graph_file::kMagic, sizeof(header.magic));
+    header.version = graph_file::kVersion;
+    header.flags = graph.directed() ? graph_file::kDirected : 0;
+    header.weight_type = graph.has_weights() ? weight_type_of(sizeof(Weight)) : graph_file::kNoWeights;
+    header.vertices = graph.vertex_count();
+    header.arcs = graph.arc_count();
+    header.edges = graph.directed() ? header.arcs : header.arcs / 2;
+
+    header.offsets_pos = align_up(sizeof(header));
+    header.targets_pos = align_up(header.offsets_pos + (header.vertices + 1) * sizeof(uint32_t));
+    uint64_t end = header.targets_pos + header.arcs * sizeof(uint32_t);
+    if (graph.has_weights()) {
+        header.weights_pos = align_up(end);
+        end = header.weights_pos + header.arcs * sizeof(Weight);
+    }
+
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error(std::string("cannot create graph file ") + path);
+    }
+
+    uint64_t pos = 0;
+    write_all(fd, &header, sizeof(header), path);
+    pos += sizeof(header);
+
+    write_padding(fd, pos, header.offsets_pos, path);
+    write_all(fd, graph.offsets().data(), graph.offsets().size_bytes(), path);
+    pos += graph.offsets().size_bytes();
+
+    write_padding(fd, pos, header.targets_pos, path);
+    write_all(fd, graph.targets().data(), graph.targets().size_bytes(), path);
+    pos += graph.targets().size_bytes();
+
+    if (graph.has_weights()) {
+        write_padding(fd, pos, header.weights_pos, path);
+        write_all(fd, graph.weights().data(), graph.weights().size_bytes(), path);
+    }
+
+    close(fd);
+}
+
+template <class Weight>
+BasicCSRGraph<uint32_t, Weight> load_graph_file(const char* path, bool directed, bool weighted) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(std::string("cannot open graph file ") + path);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(GraphFileHeader)) {
+        close(fd);
+        throw std::runtime_error(std::string("not a graph file: ") + path);
+    }
+
+    auto mapping = std::make_shared<Mapping<Weight>>();
+    mapping->size = st.st_size;
+    mapping->base = mmap(nullptr, mapping->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping->base == MAP_FAILED) {
+        mapping->base = nullptr;
+        throw std::runtime_error(std::string("cannot map graph file ") + path);
+    }
+
+    const char* base = static_cast<const char*>(mapping->base);
+    GraphFileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+
+    // размеры проверяются до умножений, чтобы позиции секций не переполнились
+    bool valid = std::memcmp(header.magic, graph_file::kMagic, sizeof(header.magic)) == 0 &&
+                 header.version == graph_file::kVersion &&
+                 header.weight_type <= graph_file::kInt64Weights &&
+                 header.vertices < static_cast<uint64_t>(std::numeric_limits<int>::max()) &&
+                 header.arcs <= std::numeric_limits<uint32_t>::max() &&
+                 header.offsets_pos <= mapping->size && header.targets_pos <= mapping->size &&
+                 header.weights_pos <= mapping->size &&
+                 header.offsets_pos + (header.vertices + 1) * sizeof(uint32_t) <= mapping->size &&
+                 header.targets_pos + header.arcs * sizeof(uint32_t) <= mapping->size &&
+                 (header.weight_type == graph_file::kNoWeights ||
+                  header.weights_pos + header.arcs * weight_size(header.weight_type) <= mapping->size);
+    if (!valid) {
+        throw std::runtime_error(std::string("corrupted graph file ") + path);
+    }
+    bool file_directed = (header.flags & graph_file::kDirected) != 0;
+    if (file_directed != directed) {
+        throw std::runtime_error(std::string("graph file ") + path + (file_directed ? " is directed" : " is undirected") +
+                                 ", the task expects " + (directed ? "a directed" : "an undirected") + " graph");
+    }
+    if (weighted && header.weight_type == graph_file::kNoWeights) {
+        throw std::runtime_error(std::string("graph file ") + path + " has no weights, the task expects them");
+    }
+
+    madvise(mapping->base, mapping->size, MADV_WILLNEED);
+
+    int n = static_cast<int>(header.vertices);
+    std::span<const uint32_t> offsets(reinterpret_cast<const uint32_t*>(base + header.offsets_pos), n + 1);
+    std::span<const uint32_t> targets(reinterpret_cast<const uint32_t*>(base + header.targets_pos), header.arcs);
+    // Решатели индексируют по offsets и targets без проверок, поэтому CSR
+    // проверяется целиком: один последовательный проход по отображению.
+    if (!valid_csr(n, offsets, targets)) {
+        throw std::runtime_error(std::string("corrupted graph file ") + path);
+    }
+    std::span<const Weight> weights;
+    const char* weights_data = base + header.weights_pos;
+    if (header.weight_type == weight_type_of(sizeof(Weight))) {
+        weights = std::span<const Weight>(reinterpret_cast<const Weight*>(weights_data), header.arcs);
+    } else if (header.weight_type == graph_file::kInt32Weights) {
+        weights = convert_weights<int32_t>(weights_data, header.arcs, mapping->converted_weights, path);
+    } else if (header.weight_type == graph_file::kInt64Weights) {
+        weights = convert_weights<int64_t>(weights_data, header.arcs, mapping->converted_weights, path);
+    }
+
+    return BasicCSRGraph<uint32_t, Weight>::view(n, file_directed, offsets, targets, weights, std::move(mapping));
+}
+
+template void save_graph_file(const char*, const BasicCSRGraph<uint32_t, int32_t>&);
+template void save_graph_file(const char*, const BasicCSRGraph<uint32_t, int64_t>&);
+template BasicCSRGraph<uint32_t, int32_t> load_graph_file<int32_t>(const char*, bool, bool);
+template BasicCSRGraph<uint32_t, int64_t> load_graph_file<int64_t>(const char*, bool, bool);
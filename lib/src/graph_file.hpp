@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+#include "csr_graph.hpp"
+
+// Бинарный формат графа (little-endian):
+//   GraphFileHeader, затем секции offsets (uint32, n + 1), targets (uint32)
+//   и, если есть, weights (int32 или int64, см. weight_type). Каждая секция
+//   выровнена на 64 байта, поэтому файл можно отображать в память и
+//   использовать как CSR напрямую.
+struct GraphFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t weight_type;
+    uint32_t reserved;
+    uint64_t vertices;
+    uint64_t edges;
+    uint64_t arcs;
+    uint64_t offsets_pos;
+    uint64_t targets_pos;
+    uint64_t weights_pos;
+};
+
+namespace graph_file {
+
+constexpr char kMagic[8] = {'C', 'S', 'R', 'G', 'R', 'A', 'P', 'H'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kDirected = 1;
+constexpr uint32_t kNoWeights = 0;
+constexpr uint32_t kInt32Weights = 1;
+constexpr uint32_t kInt64Weights = 2;
+constexpr uint64_t kAlignment = 64;
+
+}  // namespace graph_file
+
+// Записывает граф в файл; бросает std::runtime_error при ошибке ввода-вывода.
+// Веса пишутся в ширине Weight.
+template <class Weight>
+void save_graph_file(const char* path, const BasicCSRGraph<uint32_t, Weight>& graph);
+
+// Отображает файл в память (MAP_SHARED, только чтение) и возвращает CSR,
+// ссылающийся на страницы файла: разбор не нужен, а кэш страниц общий для
+// всех процессов, открывших тот же файл. Если ширина весов в файле не
+// совпадает с Weight, веса копируются (std::overflow_error, когда они не
+// помещаются). directed и weighted — что ждёт решатель: файл, собранный для
+// другой задачи (другая ориентированность или нет весов), отвергается с
+// std::runtime_error; лишние веса не мешают.
+template <class Weight = graph_weight_t>
+BasicCSRGraph<uint32_t, Weight> load_graph_file(const char* path, bool directed, bool weighted);
+
+// Реализация в graph_file.cpp для обеих ширин весов.
+extern template void save_graph_file(const char*, const BasicCSRGraph<uint32_t, int32_t>&);
+extern template void save_graph_file(const char*, const BasicCSRGraph<uint32_t, int64_t>&);
+extern template BasicCSRGraph<uint32_t, int32_t> load_graph_file<int32_t>(const char*, bool, bool);
+extern template BasicCSRGraph<uint32_t, int64_t> load_graph_file<int64_t>(const char*, bool, bool);
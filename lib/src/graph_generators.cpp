@@ -0,0 +1,208 @@
+#include "graph_generators.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+EdgeList random_graph(int n, long long m, uint64_t seed) {
+    EdgeList edges(n);
+    if (n < 2) return edges;
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    edges.reserve(m);
+    while (edges.size() < m) {
+        int u = vertex(rng);
+        int v = vertex(rng);
+        if (u != v) edges.add(u, v);
+    }
+    return edges;
+}
+
+EdgeList random_dag(int n, long long m, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    EdgeList edges = random_graph(n, m, seed ^ 0x9e3779b97f4a7c15ULL);
+    for (int i = 0; i < edges.size(); ++i) {
+        int u = edges.from[i];
+        int v = edges.to[i];
+        if (u > v) std::swap(u, v);
+        edges.from[i] = order[u];
+        edges.to[i] = order[v];
+    }
+    return edges;
+}
+
+EdgeList rmat_graph(int n, long long m, uint64_t seed, double a, double b, double c) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    int scale = 0;
+    while ((1LL << scale) < n) ++scale;
+
+    std::vector<int> label(n);
+    std::iota(label.begin(), label.end(), 0);
+    std::shuffle(label.begin(), label.end(), rng);
+
+    EdgeList edges(n);
+    edges.reserve(m);
+    if (n < 2) return edges;
+    while (edges.size() < m) {
+        long long u = 0;
+        long long v = 0;
+        for (int bit = 0; bit < scale; ++bit) {
+            double p = coin(rng);
+            u <<= 1;
+            v <<= 1;
+            if (p < a) {
+            } else if (p < a + b) {
+                v |= 1;
+            } else if (p < a + b + c) {
+                u |= 1;
+            } else {
+                u |= 1;
+                v |= 1;
+            }
+        }
+        if (u >= n || v >= n || u == v) continue;
+        edges.add(label[u], label[v]);
+    }
+    return edges;
+}
+
+EdgeList layered_dag(int n, int width, long long m, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<int> label(n);
+    std::iota(label.begin(), label.end(), 0);
+    std::shuffle(label.begin(), label.end(), rng);
+
+    EdgeList edges(n);
+    edges.reserve(std::max<long long>(m, n));
+    if (width < 1) width = 1;
+    int layers = (n + width - 1) / width;
+
+    for (int v = width; v < n; ++v) {
+        int prev_layer = v / width - 1;
+        int u = prev_layer * width + static_cast<int>(rng() % width);
+        edges.add(label[u], label[v]);
+    }
+
+    if (layers < 2) return edges;
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    while (edges.size() < m) {
+        int u = vertex(rng);
+        int v = vertex(rng);
+        if (u / width > v / width) std::swap(u, v);
+        if (u / width == v / width) continue;
+        edges.add(label[u], label[v]);
+    }
+    return edges;
+}
+
+EdgeList layered_network(int n, int width, long long m, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    EdgeList edges(n);
+    int inner = n - 2;
+    if (inner <= 0) {
+        if (n == 2) edges.add(0, 1);
+        return edges;
+    }
+    if (width < 1) width = 1;
+    width = std::min(width, inner);
+    int layers = (inner + width - 1) / width;
+    auto layer_begin = [&](int layer) { return 1 + layer * width; };
+    auto layer_end = [&](int layer) { return std::min(1 + (layer + 1) * width, n - 1); };
+
+    for (int v = layer_begin(0); v < layer_end(0); ++v) {
+        edges.add(0, v);
+    }
+    for (int v = layer_begin(layers - 1); v < layer_end(layers - 1); ++v) {
+        edges.add(v, n - 1);
+    }
+
+    long long between = std::max<long long>(0, m - edges.size());
+    int out_degree = layers > 1 ? std::max<long long>(1, between / std::max(1, inner - width)) : 0;
+    for (int layer = 0; layer + 1 < layers; ++layer) {
+        int next_begin = layer_begin(layer + 1);
+        int next_size = layer_end(layer + 1) - next_begin;
+        for (int u = layer_begin(layer); u < layer_end(layer); ++u) {
+            for (int k = 0; k < out_degree; ++k) {
+                edges.add(u, next_begin + static_cast<int>(rng() % next_size));
+            }
+        }
+    }
+    return edges;
+}
+
+EdgeList grid_graph(int rows, int cols) {
+    EdgeList edges(rows * cols);
+    edges.reserve(2 * rows * cols);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            int v = r * cols + c;
+            if (c + 1 < cols) edges.add(v, v + 1);
+            if (r + 1 < rows) edges.add(v, v + cols);
+        }
+    }
+    return edges;
+}
+
+EdgeList chain_graph(int n) {
+    EdgeList edges(n);
+    edges.reserve(n);
+    for (int v = 0; v + 1 < n; ++v) {
+        edges.add(v, v + 1);
+    }
+    return edges;
+}
+
+EdgeList random_tree(int n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    EdgeList edges(n);
+    edges.reserve(n);
+    for (int v = 1; v < n; ++v) {
+        edges.add(std::uniform_int_distribution<int>(0, v - 1)(rng), v);
+    }
+    return edges;
+}
+
+EdgeList caterpillar_tree(int n, int spine, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    spine = std::max(1, std::min(spine, n));
+    EdgeList edges = chain_graph(spine);
+    edges.n = n;
+    for (int v = spine; v < n; ++v) {
+        edges.add(static_cast<int>(rng() % spine), v);
+    }
+    return edges;
+}
+
+void assign_random_weights(EdgeList& edges, long long lo, long long hi, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<long long> weight(lo, hi);
+    edges.weights.resize(edges.size());
+    for (long long& w : edges.weights) {
+        w = weight(rng);
+    }
+}
+
+RmqQueryStream::Query RmqQueryStream::next() {
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::uniform_int_distribution<int> index(0, n - 1);
+    if (coin(rng) < update_ratio) {
+        return {2, index(rng), static_cast<int>(static_cast<uint32_t>(rng()) >> 1) - (1 << 30)};
+    }
+    int l = index(rng);
+    int r = index(rng);
+    if (l > r) std::swap(l, r);
+    return {1, l, r};
+}
+
+std::pair<int, int> PairQueryStream::next() {
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    int u = vertex(rng);
+    int v = vertex(rng);
+    return {u, v};
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <utility>
+
+#include "edge_list.hpp"
+
+// Детерминированные генераторы графов: один и тот же seed даёт один и тот же граф.
+// Вершины нумеруются с 0.
+
+// Случайный граф G(n, m): m рёбер с равновероятными концами, без петель.
+EdgeList random_graph(int n, long long m, uint64_t seed);
+
+// Случайный ацикличный граф: рёбра идут от меньшего номера к большему
+// в случайной перестановке вершин.
+EdgeList random_dag(int n, long long m, uint64_t seed);
+
+// Степенной граф R-MAT: каждое ребро спускается по квадрантам матрицы
+// смежности с вероятностями a, b, c и 1 - a - b - c. Номера вершин
+// перемешиваются, чтобы степень не коррелировала с номером.
+EdgeList rmat_graph(int n, long long m, uint64_t seed, double a = 0.57, double b = 0.19, double c = 0.19);
+
+// Ацикличный граф из слоёв по width вершин: у каждой вершины не первого слоя
+// есть ребро из предыдущего слоя (глубина вершины равна номеру её слоя),
+// остальные рёбра ведут из слоя в любой более поздний. Номера перемешаны.
+EdgeList layered_dag(int n, int width, long long m, uint64_t seed);
+
+// Слоистая сеть для потока: исток 0, сток n - 1, между ними слои по width
+// вершин; исток соединён с первым слоем, последний слой — со стоком,
+// соседние слои — примерно m рёбрами в сумме.
+EdgeList layered_network(int n, int width, long long m, uint64_t seed);
+
+// Решётка rows x cols, рёбра к правому и нижнему соседу.
+EdgeList grid_graph(int rows, int cols);
+
+// Путь 0 - 1 - ... - (n - 1).
+EdgeList chain_graph(int n);
+
+// Случайное дерево: родитель вершины v выбирается среди 0 .. v - 1.
+EdgeList random_tree(int n, uint64_t seed);
+
+// Гусеница: путь из spine вершин, остальные вершины — листья, подвешенные
+// к случайным вершинам пути. Худший случай для глубины рекурсии.
+EdgeList caterpillar_tree(int n, int spine, uint64_t seed);
+
+// Проставляет рёбрам случайные веса из [lo, hi].
+void assign_random_weights(EdgeList& edges, long long lo, long long hi, uint64_t seed);
+
+// Поток запросов RMQ для task_07 без хранения в памяти:
+// тип 1 — минимум на [l, r], тип 2 — присваивание a[l] = r (индексы с 0).
+class RmqQueryStream {
+public:
+    struct Query {
+        int type;
+        int l;
+        int r;
+    };
+
+    RmqQueryStream(int n, double update_ratio, uint64_t seed)
+        : n(n), update_ratio(update_ratio), rng(seed) {}
+
+    Query next();
+
+private:
+    int n;
+    double update_ratio;
+    std::mt19937_64 rng;
+};
+
+// Поток пар вершин (например, запросов LCA) с равновероятными концами.
+class PairQueryStream {
+public:
+    PairQueryStream(int n, uint64_t seed) : n(n), rng(seed) {}
+
+    std::pair<int, int> next();
+
+private:
+    int n;
+    std::mt19937_64 rng;
+};
@@ -0,0 +1,12 @@
+#include "parallel.hpp"
+
+#include <cstdlib>
+
+unsigned default_thread_count() {
+    if (const char* env = std::getenv("GRAPH_THREADS")) {
+        int value = std::atoi(env);
+        if (value > 0) return value;
+    }
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Число потоков по умолчанию: переменная окружения GRAPH_THREADS, иначе
+// число аппаратных потоков.
+unsigned default_thread_count();
+
+// Делит [0, count) на parts непрерывных кусков почти равной длины и вызывает
+// f(part, begin, end) для каждого в своём потоке (кусок 0 — в вызывающем).
+// Разбиение зависит только от count и parts, поэтому проходы с одинаковыми
+// аргументами видят одни и те же куски.
+template <class F>
+void parallel_blocks(size_t count, unsigned parts, F&& f) {
+    if (parts <= 1) {
+        f(0u, size_t(0), count);
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(parts - 1);
+    for (unsigned part = 1; part < parts; ++part) {
+        workers.emplace_back([&f, count, parts, part] {
+            f(part, count * part / parts, count * (part + 1) / parts);
+        });
+    }
+    f(0u, size_t(0), count / parts);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Делит вершины CSR-графа на parts кусков с примерно равным числом дуг
+// (offsets — n + 1 смещений) и вызывает f(part, begin, end) для каждого
+// куска вершин в своём потоке.
+template <class Offsets, class F>
+void parallel_vertex_blocks(const Offsets& offsets, unsigned parts, F&& f) {
+    if (offsets.empty()) return;
+    int n = static_cast<int>(offsets.size()) - 1;
+    size_t arcs = offsets.back();
+    auto bound = [&](unsigned part) {
+        if (part == 0) return 0;
+        if (part == parts) return n;
+        auto it = std::lower_bound(offsets.begin(), offsets.end(), arcs * part / parts);
+        return static_cast<int>(it - offsets.begin());
+    };
+    parallel_blocks(parts, parts, [&](unsigned part, size_t, size_t) {
+        f(part, bound(part), bound(part + 1));
+    });
+}
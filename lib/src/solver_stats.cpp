@@ -0,0 +1,59 @@
+#include "solver_stats.hpp"
+
+namespace {
+
+uint64_t* find(std::vector<std::pair<std::string, uint64_t>>& items, std::string_view name) {
+    for (auto& [key, value] : items) {
+        if (key == name) return &value;
+    }
+    items.emplace_back(name, 0);
+    return &items.back().second;
+}
+
+uint64_t lookup(const std::vector<std::pair<std::string, uint64_t>>& items, std::string_view name) {
+    for (const auto& [key, value] : items) {
+        if (key == name) return value;
+    }
+    return 0;
+}
+
+void write_object(FastWriter& out, const std::vector<std::pair<std::string, uint64_t>>& items, uint64_t divisor) {
+    out << '{';
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (i > 0) out << ", ";
+        out << '"' << items[i].first << "\": " << items[i].second / divisor;
+    }
+    out << '}';
+}
+
+}  // namespace
+
+void SolverStats::add(std::string_view counter, uint64_t value) {
+    *find(counters, counter) += value;
+}
+
+void SolverStats::add_time(std::string_view phase, uint64_t nanoseconds) {
+    *find(phases, phase) += nanoseconds;
+}
+
+uint64_t SolverStats::counter(std::string_view name) const {
+    return lookup(counters, name);
+}
+
+uint64_t SolverStats::time_ns(std::string_view phase) const {
+    return lookup(phases, phase);
+}
+
+void SolverStats::clear() {
+    counters.clear();
+    phases.clear();
+}
+
+void SolverStats::write_json(FastWriter& out) const {
+    out << "{\"solver\": \"" << solver << "\", \"enabled\": " << (SOLVER_STATS ? "true" : "false");
+    out << ", \"counters\": ";
+    write_object(out, counters, 1);
+    out << ", \"phases_us\": ";
+    write_object(out, phases, 1000);
+    out << "}\n";
+}
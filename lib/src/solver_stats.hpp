@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "fast_writer.hpp"
+
+// Счётчики и время фаз решателей. Сбор включается при сборке
+// (cmake -DSOLVER_STATS=ON); без него макросы ниже раскрываются в ничто и
+// горячие циклы не меняются, а get_stats() решателей возвращает пустой набор.
+#ifndef SOLVER_STATS
+#define SOLVER_STATS 0
+#endif
+
+class SolverStats {
+public:
+    explicit SolverStats(std::string_view solver = "") : solver(solver) {}
+
+    void add(std::string_view counter, uint64_t value);
+    void add_time(std::string_view phase, uint64_t nanoseconds);
+
+    uint64_t counter(std::string_view name) const;
+    uint64_t time_ns(std::string_view phase) const;
+    bool empty() const { return counters.empty() && phases.empty(); }
+    void clear();
+
+    // {"solver": ..., "enabled": ..., "counters": {...}, "phases_us": {...}}
+    void write_json(FastWriter& out) const;
+
+private:
+    std::string solver;
+    std::vector<std::pair<std::string, uint64_t>> counters;
+    std::vector<std::pair<std::string, uint64_t>> phases;
+};
+
+// Добавляет время жизни объекта к фазе phase.
+class PhaseTimer {
+public:
+    PhaseTimer(SolverStats& stats, std::string_view phase)
+        : stats(stats), phase(phase), start(std::chrono::steady_clock::now()) {}
+    ~PhaseTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        stats.add_time(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    SolverStats& stats;
+    std::string_view phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Последовательные фазы одной функции: lap(phase) относит к phase время,
+// прошедшее с предыдущего lap (или с создания).
+class PhaseClock {
+public:
+    explicit PhaseClock(SolverStats& stats) : stats(stats), last(std::chrono::steady_clock::now()) {}
+
+    void lap(std::string_view phase) {
+        auto now = std::chrono::steady_clock::now();
+        stats.add_time(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count());
+        last = now;
+    }
+
+private:
+    SolverStats& stats;
+    std::chrono::steady_clock::time_point last;
+};
+
+#define SOLVER_STATS_CONCAT_(a, b) a##b
+#define SOLVER_STATS_CONCAT(a, b) SOLVER_STATS_CONCAT_(a, b)
+
+#if SOLVER_STATS
+// Код, который нужен только для сбора статистики (локальные счётчики).
+#define STATS_ONLY(...) __VA_ARGS__
+#define STATS_ADD(stats, counter, value) (stats).add(counter, value)
+// Время до конца текущего блока попадает в фазу phase.
+#define STATS_PHASE(stats, phase) PhaseTimer SOLVER_STATS_CONCAT(stats_phase_, __LINE__)(stats, phase)
+// Часы для STATS_LAP в текущем блоке.
+#define STATS_CLOCK(stats) PhaseClock stats_clock(stats)
+#define STATS_LAP(phase) stats_clock.lap(phase)
+#else
+#define STATS_ONLY(...)
+#define STATS_ADD(stats, counter, value) ((void)0)
+#define STATS_PHASE(stats, phase) ((void)0)
+#define STATS_CLOCK(stats) ((void)0)
+#define STATS_LAP(phase) ((void)0)
+#endif
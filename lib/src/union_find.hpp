@@ -0,0 +1,52 @@
+#pragma once
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+// Система непересекающихся множеств: объединение по размеру и сжатие путей
+// делением пополам (без рекурсии), амортизированно почти O(1) на операцию.
+class UnionFind {
+public:
+    UnionFind() = default;
+    explicit UnionFind(int n) { reset(n); }
+
+    void reset(int n) {
+        parent.resize(n);
+        std::iota(parent.begin(), parent.end(), 0);
+        size.assign(n, 1);
+    }
+
+    // Делает v снова одиночным множеством. Корректно, только если на v
+    // больше никто не ссылается (например, всё его множество сбрасывается).
+    void isolate(int v) {
+        parent[v] = v;
+        size[v] = 1;
+    }
+
+    int find(int v) {
+        while (parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    }
+
+    // Возвращает корень объединённого множества.
+    int unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return a;
+        if (size[a] < size[b]) std::swap(a, b);
+        parent[b] = a;
+        size[a] += size[b];
+        return a;
+    }
+
+    bool same(int a, int b) { return find(a) == find(b); }
+    int set_size(int v) { return size[find(v)]; }
+
+private:
+    std::vector<int> parent;
+    std::vector<int> size;
+};
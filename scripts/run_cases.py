@@ -2,13 +2,15 @@
 from __future__ import annotations
 
 import argparse
+import json
+import math
 import os
 import re
 from enum import Enum
 import subprocess
 import sys
 import time
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 from pathlib import Path
 from typing import Dict, Iterable, List, Optional, Tuple
 import tempfile
@@ -36,6 +38,10 @@ class CaseResult:
     duration_ms: int
     message: str = ""
     peak_kb: Optional[int] = None
+    samples_ms: List[float] = field(default_factory=list)
+    # Set when the case is slower than --perf-baseline; independent of status,
+    # so a SLOW case that also regressed still counts as SLOW.
+    regression: Optional[str] = None
 
 
 def find_repo_root(start: Path) -> Path:
@@ -217,6 +223,94 @@ def format_ms(seconds: float) -> int:
     return int(round(seconds * 1000))
 
 
+def median(values: List[float]) -> float:
+    ordered = sorted(values)
+    mid = len(ordered) // 2
+    if len(ordered) % 2:
+        return ordered[mid]
+    return (ordered[mid - 1] + ordered[mid]) / 2
+
+
+def percentile(values: List[float], q: float) -> float:
+    # Nearest-rank percentile
+    ordered = sorted(values)
+    rank = max(1, math.ceil(q / 100 * len(ordered)))
+    return ordered[rank - 1]
+
+
+def mann_whitney_p_greater(current: List[float], baseline: List[float]) -> float:
+    """One-sided Mann-Whitney U test (normal approximation with tie correction):
+    p-value for the hypothesis that `current` tends to be larger than `baseline`."""
+    n1, n2 = len(current), len(baseline)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    pooled = sorted([(v, 0) for v in current] + [(v, 1) for v in baseline])
+    ranks = [0.0] * len(pooled)
+    tie_term = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        t = j - i + 1
+        tie_term += t ** 3 - t
+        i = j + 1
+    r1 = sum(r for r, (_, group) in zip(ranks, pooled) if group == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (u1 - n1 * n2 / 2 - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2))
+
+
+def load_baseline(path: Path) -> Dict[str, dict]:
+    if not path.exists():
+        return {}
+    data = json.loads(path.read_text(encoding="utf-8"))
+    return data.get("cases", {})
+
+
+def save_baseline(path: Path, cases: Dict[str, dict], repeat: int) -> None:
+    payload = {"version": 1, "repeat": repeat, "cases": dict(sorted(cases.items()))}
+    write_text(path, json.dumps(payload, indent=2) + "\n")
+
+
+def baseline_entry(result: CaseResult, peaks: List[int]) -> dict:
+    return {
+        "median_ms": round(median(result.samples_ms), 3),
+        "p95_ms": round(percentile(result.samples_ms, 95), 3),
+        "peak_kb": int(median(peaks)) if peaks else None,
+        "samples_ms": [round(v, 3) for v in result.samples_ms],
+    }
+
+
+def check_regression(result: CaseResult, entry: dict, args: argparse.Namespace) -> Optional[str]:
+    """Returns a description of the regression against the baseline entry, or None."""
+    reasons: List[str] = []
+    base_samples = entry.get("samples_ms") or [entry["median_ms"]]
+    base_median = entry["median_ms"]
+    cur_median = median(result.samples_ms)
+    if (
+        base_median > 0
+        and cur_median > base_median * (1 + args.perf_threshold)
+        and cur_median - base_median > args.perf_min_delta_ms
+    ):
+        p = mann_whitney_p_greater(result.samples_ms, base_samples)
+        if p < args.perf_alpha:
+            reasons.append(
+                f"time {cur_median:.1f} ms vs {base_median:.1f} ms "
+                f"(+{(cur_median / base_median - 1) * 100:.0f}%, p={p:.3f})"
+            )
+    base_peak = entry.get("peak_kb")
+    if base_peak and result.peak_kb is not None and result.peak_kb > base_peak * (1 + args.perf_mem_threshold):
+        reasons.append(f"mem {result.peak_kb} KB vs {base_peak} KB")
+    return "; ".join(reasons) or None
+
+
 def main(argv: Optional[Iterable[str]] = None) -> int:
     parser = argparse.ArgumentParser(
         description=(
@@ -302,6 +396,55 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
             "Print top-N slowest cases in the summary (0 to disable)."
         ),
     )
+    parser.add_argument(
+        "--repeat",
+        type=int,
+        default=1,
+        help="Run each case N times; timings are reported as the median (default: 1)",
+    )
+    parser.add_argument(
+        "--perf-baseline",
+        type=Path,
+        default=None,
+        help=(
+            "Baseline JSON with per-case median/p95 time and peak memory. "
+            "Cases are compared against it unless --save-baseline is given."
+        ),
+    )
+    parser.add_argument(
+        "--save-baseline",
+        action="store_true",
+        help="Record current measurements into --perf-baseline instead of comparing",
+    )
+    parser.add_argument(
+        "--perf-threshold",
+        type=float,
+        default=0.10,
+        help="Minimal relative slowdown of the median to report (default: 0.10)",
+    )
+    parser.add_argument(
+        "--perf-min-delta-ms",
+        type=float,
+        default=2.0,
+        help="Ignore slowdowns smaller than this many ms, i.e. process start-up noise (default: 2.0)",
+    )
+    parser.add_argument(
+        "--perf-alpha",
+        type=float,
+        default=0.05,
+        help="Significance level of the Mann-Whitney test for time regressions (default: 0.05)",
+    )
+    parser.add_argument(
+        "--perf-mem-threshold",
+        type=float,
+        default=0.10,
+        help="Minimal relative growth of peak memory to report (default: 0.10)",
+    )
+    parser.add_argument(
+        "--fail-on-regression",
+        action="store_true",
+        help="Exit with non-zero status if any case regressed against --perf-baseline",
+    )
     parser.add_argument(
         "--normalize",
         choices=["strip", "keep", "lines"],
@@ -327,6 +470,8 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
     )
 
     args = parser.parse_args(list(argv) if argv is not None else None)
+    if args.save_baseline and args.perf_baseline is None:
+        parser.error("--save-baseline requires --perf-baseline")
 
     script_path = Path(__file__).resolve()
     repo_root = find_repo_root(script_path)
@@ -378,7 +523,11 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
 
     # Decide whether to measure memory
     time_tool = find_time_tool()
-    measure_memory = bool(time_tool) and (args.mem_limit_mb is not None or args.report_memtop)
+    measure_memory = bool(time_tool) and (
+        args.mem_limit_mb is not None or args.report_memtop or args.perf_baseline is not None
+    )
+    case_peaks: Dict[Tuple[str, str], List[int]] = {}
+    case_samples: Dict[Tuple[str, str], List[float]] = {}
 
     for task in sorted(requested):
         exe = task_to_exe.get(task)
@@ -403,13 +552,25 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
                 continue
 
             stdin_data = read_text(input_file)
-            if measure_memory:
-                rc, stdout, stderr, duration, peak_kb = run_executable_with_memory(
-                    exe, stdin_data, args.timeout, time_tool  # type: ignore[arg-type]
-                )
-            else:
-                rc, stdout, stderr, duration = run_executable(exe, stdin_data, args.timeout)
-                peak_kb = None
+            samples: List[float] = []
+            peaks: List[int] = []
+            for _ in range(max(1, args.repeat)):
+                if measure_memory:
+                    rc, stdout, stderr, duration, peak_kb = run_executable_with_memory(
+                        exe, stdin_data, args.timeout, time_tool  # type: ignore[arg-type]
+                    )
+                else:
+                    rc, stdout, stderr, duration = run_executable(exe, stdin_data, args.timeout)
+                    peak_kb = None
+                samples.append(duration)
+                if peak_kb is not None:
+                    peaks.append(peak_kb)
+                if rc == 124:
+                    break
+            duration = median(samples)
+            peak_kb = int(median(peaks)) if peaks else None
+            case_peaks[(task, case_name)] = peaks
+            case_samples[(task, case_name)] = [v * 1000 for v in samples]
             duration_ms = format_ms(duration)
 
             if rc == 124:  # timeout code used above
@@ -494,6 +655,34 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
         print("\nNo cases were executed.")
         return 2
 
+    regressions: List[CaseResult] = []
+    if args.perf_baseline is not None:
+        baseline = load_baseline(args.perf_baseline)
+        measured_ok = [r for r in results if r.status in {CaseStatus.OK, CaseStatus.SLOW}]
+        for r in measured_ok:
+            r.samples_ms = case_samples.get((r.task, r.case_name), [])
+        if args.save_baseline:
+            for r in measured_ok:
+                baseline[f"{r.task}/{r.case_name}"] = baseline_entry(r, case_peaks.get((r.task, r.case_name), []))
+            save_baseline(args.perf_baseline, baseline, max(1, args.repeat))
+            print(f"\nSaved baseline for {len(measured_ok)} case(s) to '{args.perf_baseline}'")
+        else:
+            compared = 0
+            for r in measured_ok:
+                entry = baseline.get(f"{r.task}/{r.case_name}")
+                if entry is None or not r.samples_ms:
+                    continue
+                compared += 1
+                reason = check_regression(r, entry, args)
+                if reason is not None:
+                    r.regression = reason
+                    regressions.append(r)
+            print(f"\nCompared {compared} case(s) with baseline '{args.perf_baseline}'")
+            if regressions:
+                print("Perf regressions:")
+                for r in regressions:
+                    print(f"- {r.task}/{r.case_name}: {r.regression}")
+
     passed = sum(1 for r in results if r.status == CaseStatus.OK)
     failed = sum(1 for r in results if r.status == CaseStatus.FAIL)
     timeouts = sum(1 for r in results if r.status == CaseStatus.TIMEOUT)
@@ -501,11 +690,12 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
     slow = sum(1 for r in results if r.status == CaseStatus.SLOW)
     missing_exec = sum(1 for r in results if r.status == CaseStatus.EXEC_MISSING)
     mem_exceeded = sum(1 for r in results if r.status == CaseStatus.MEM_EXCEEDED)
+    regressed = len(regressions)
 
     print(
         f"\n=== Summary ===\n"
         f"Cases run: {passed + failed + timeouts + missing_expected + missing_exec + slow + mem_exceeded}\n"
-        f"OK: {passed}, FAIL: {failed}, TIMEOUT: {timeouts}, SLOW: {slow}, MEM_EXCEEDED: {mem_exceeded}, NO_EXPECTED: {missing_expected}, EXEC_MISSING: {missing_exec}"
+        f"OK: {passed}, FAIL: {failed}, TIMEOUT: {timeouts}, SLOW: {slow}, MEM_EXCEEDED: {mem_exceeded}, REGRESSED: {regressed}, NO_EXPECTED: {missing_expected}, EXEC_MISSING: {missing_exec}"
     )
 
     if args.report_slowest and results:
@@ -519,7 +709,8 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
         if top_n:
             print("\nTop slowest cases:")
             for r in top_n:
-                print(f"- {r.task}/{r.case_name}: {r.duration_ms} ms [{r.status.value}] {r.message}")
+                regressed_tag = ", regressed" if r.regression else ""
+                print(f"- {r.task}/{r.case_name}: {r.duration_ms} ms [{r.status.value}{regressed_tag}] {r.message}")
 
     if args.report_memtop and results:
         mem_measured = [r for r in results if r.peak_kb is not None]
@@ -539,6 +730,7 @@ def main(argv: Optional[Iterable[str]] = None) -> int:
         or missing_expected
         or (args.fail_on_slow and slow)
         or (args.fail_on_mem and mem_exceeded)
+        or (args.fail_on_regression and regressed)
     ):
         return 1
     return 0
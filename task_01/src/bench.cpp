@@ -0,0 +1,242 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <set>
+#include "bench_alloc.hpp"
+#include "edge_normalize.hpp"
+#include "failure_batch.h"
+#include "failure_index.h"
+#include "graph.h"
+#include "graph_generators.hpp"
+#include "parallel_critical.h"
+
+enum Family { kRandom, kGrid, kChain, kFragments };
+
+static const char* family_name(int family) {
+    static const char* names[] = {"random", "grid", "chain", "fragments"};
+    return names[family];
+}
+
+static EdgeList make_graph(int family, int n) {
+    switch (family) {
+        case kRandom:
+            return random_graph(n, 2LL * n, 42);
+        case kGrid: {
+            int side = std::sqrt(n);
+            return grid_graph(side, side);
+        }
+        case kFragments: {
+            // много независимых подсетей по 64 вершины
+            EdgeList edges(n);
+            for (int base = 0; base + 64 <= n; base += 64) {
+                EdgeList part = random_graph(64, 96, base);
+                for (int i = 0; i < part.size(); ++i) {
+                    edges.add(part.from[i] + base, part.to[i] + base);
+                }
+            }
+            return edges;
+        }
+        default:
+            return chain_graph(n);
+    }
+}
+
+static void BM_FindCriticalElements(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    Graph g(CSRGraph::from_edges(edges, false));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            g.find_critical_elements();
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_FindCriticalElementsArena(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    Arena arena;
+    Graph g(CSRGraph::from_edges(edges, false), &arena);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            g.find_critical_elements();
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Тарьян–Вишкин на state.range(2) потоках; время — настенное.
+static void BM_FindCriticalElementsParallel(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    CSRGraph graph = CSRGraph::from_edges(edges, false);
+    std::vector<int> articulation_points;
+    std::vector<std::pair<int, int>> bridges;
+    SolverStats stats;
+    for (auto _ : state) {
+        find_critical_elements_parallel(graph, state.range(2), articulation_points, bridges, stats);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_FindCriticalElementsByComponent(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    Graph g(CSRGraph::from_edges(edges, false));
+    for (auto _ : state) {
+        g.find_critical_elements_by_component(state.range(2));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_BuildFromEdges(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            Graph g(edges.n);
+            for (int i = 0; i < edges.size(); ++i) {
+                g.add_edge(edges.from[i], edges.to[i]);
+            }
+            g.find_critical_elements();
+            benchmark::DoNotOptimize(g);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_BuildFailureIndex(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    CSRGraph graph = CSRGraph::from_edges(edges, false);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            FailureIndex index(graph);
+            benchmark::DoNotOptimize(index);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Граф растёт по одному ребру; после каждого ребра нужен актуальный список
+// мостов. Пересчёт обходом здесь квадратичный, поэтому только инкрементальный.
+static void BM_IncrementalInsert(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            Graph g(edges.n);
+            g.track_incrementally();
+            for (int i = 0; i < edges.size(); ++i) {
+                g.add_edge(edges.from[i], edges.to[i]);
+            }
+            benchmark::DoNotOptimize(g.get_bridges());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * edges.size());
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Запросы об отказе вершины и ребра на готовом индексе вместо пересчёта.
+static void BM_FailureQueries(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    FailureIndex index(CSRGraph::from_edges(edges, false));
+    EdgeList queries = random_graph(edges.n, 1 << 12, 7);
+    for (auto _ : state) {
+        int connected = 0;
+        for (int i = 0; i < queries.size(); ++i) {
+            int a = queries.from[i];
+            int b = queries.to[i];
+            int e = i % edges.size();
+            connected += index.connected_without_vertex(a, b, edges.from[e]);
+            connected += index.connected_without_edge(a, b, edges.from[e], edges.to[e]);
+        }
+        benchmark::DoNotOptimize(connected);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * queries.size());
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Пакет сценариев «кабель + кабель + роутер» одним проходом по графу.
+static void BM_FailureBatch(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    FailureBatch batch(CSRGraph::from_edges(edges, false));
+    EdgeList picks = random_graph(edges.n, 1 << 12, 7);
+    std::vector<FailureSet> scenarios(picks.size());
+    for (int i = 0; i < picks.size(); ++i) {
+        int e = picks.from[i] % edges.size();
+        int f = picks.to[i] % edges.size();
+        scenarios[i].edges = {{edges.from[e], edges.to[e]}, {edges.from[f], edges.to[f]}};
+        scenarios[i].vertices = {picks.from[(i + 1) % picks.size()]};
+    }
+    for (auto _ : state) {
+        std::vector<FailureImpact> impact = batch.analyze(scenarios);
+        benchmark::DoNotOptimize(impact);
+    }
+    state.SetItemsProcessed(state.iterations() * scenarios.size());
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Удаление петель и кратных рёбер на входе драйвера: поразрядная сортировка
+// против прежнего std::set пар.
+static void BM_NormalizeEdges(benchmark::State& state) {
+    EdgeList input = random_graph(state.range(0), 4LL * state.range(0), 42);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            EdgeList edges = input;
+            normalize_undirected(edges);
+            benchmark::DoNotOptimize(edges);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * input.size());
+}
+
+static void BM_NormalizeEdgesSet(benchmark::State& state) {
+    EdgeList input = random_graph(state.range(0), 4LL * state.range(0), 42);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            std::set<std::pair<int, int>> unique_edges;
+            for (int i = 0; i < input.size(); ++i) {
+                int u = input.from[i];
+                int v = input.to[i];
+                if (u != v) unique_edges.insert({std::min(u, v), std::max(u, v)});
+            }
+            benchmark::DoNotOptimize(unique_edges);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(BM_FindCriticalElements)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid, kChain, kFragments}});
+BENCHMARK(BM_FindCriticalElementsArena)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid, kChain}});
+BENCHMARK(BM_FindCriticalElementsParallel)
+    ->ArgsProduct({{1 << 16, 1 << 20}, {kRandom, kGrid, kChain}, {1, 2, 4, 8}})
+    ->UseRealTime();
+BENCHMARK(BM_FindCriticalElementsByComponent)
+    ->ArgsProduct({{1 << 16, 1 << 20}, {kFragments, kRandom}, {1, 2, 4, 8}})
+    ->UseRealTime();
+BENCHMARK(BM_BuildFromEdges)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid}});
+BENCHMARK(BM_IncrementalInsert)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid, kChain}});
+BENCHMARK(BM_BuildFailureIndex)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid, kChain}});
+BENCHMARK(BM_FailureQueries)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid, kChain}});
+BENCHMARK(BM_FailureBatch)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid, kChain}});
+BENCHMARK(BM_NormalizeEdges)->RangeMultiplier(8)->Range(1 << 12, 1 << 18);
+BENCHMARK(BM_NormalizeEdgesSet)->RangeMultiplier(8)->Range(1 << 12, 1 << 18);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,252 @@
+#include "failure_batch.h"
+#include <algorithm>
+#include "dfs.hpp"
+#include "union_find.hpp"
+
+FailureBatch::FailureBatch(const CSRGraph& graph) : n(graph.vertex_count()) {
+    STATS_PHASE(stats, "preprocess");
+    parent.assign(n, -1);
+    pre.assign(n, -1);
+    last.assign(n, -1);
+    depth.assign(n, 0);
+    root.assign(n, -1);
+
+    struct Visitor : DfsVisitor {
+        FailureBatch& batch;
+        std::vector<int> order;
+        int timer = 0;
+        int current_root = -1;
+
+        explicit Visitor(FailureBatch& batch) : batch(batch) { order.reserve(batch.n); }
+
+        void enter(int v, int p) {
+            batch.parent[v] = p;
+            batch.pre[v] = timer++;
+            batch.depth[v] = p == -1 ? 0 : batch.depth[p] + 1;
+            batch.root[v] = current_root;
+            order.push_back(v);
+        }
+
+        void leave(int v, int) { batch.last[v] = timer - 1; }
+    };
+
+    Visitor visitor(*this);
+    DfsEngine dfs(n);
+    for (int v = 0; v < n; ++v) {
+        if (dfs.visited(v)) continue;
+        visitor.current_root = v;
+        dfs.run(graph, v, visitor);
+        components++;
+    }
+
+    // в порядке pre дети попадают к родителю уже упорядоченными
+    child_offsets.assign(n + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        if (parent[v] != -1) child_offsets[parent[v] + 1]++;
+    }
+    for (int v = 0; v < n; ++v) {
+        child_offsets[v + 1] += child_offsets[v];
+    }
+    children.resize(child_offsets[n]);
+    std::vector<int> fill(child_offsets.begin(), child_offsets.end() - 1);
+    point_offsets.assign(n + 1, 0);
+    for (int x = 0; x < n; ++x) {
+        int w = visitor.order[x];
+        if (parent[w] != -1) children[fill[parent[w]]++] = w;
+        for (int a : graph.neighbors(w)) {
+            if (pre[a] < pre[w] && in_subtree(a, w)) point_depths.push_back(depth[a]);
+        }
+        point_offsets[x + 1] = point_depths.size();
+    }
+    STATS_ADD(stats, "points", point_depths.size());
+}
+
+int FailureBatch::child_towards(int ancestor, int v) const {
+    // дети упорядочены по pre: нужен последний с pre не больше pre[v]
+    auto begin = children.begin() + child_offsets[ancestor];
+    auto end = children.begin() + child_offsets[ancestor + 1];
+    auto it = std::upper_bound(begin, end, pre[v], [&](int value, int child) { return value < pre[child]; });
+    return *(it - 1);
+}
+
+int FailureBatch::multiplicity(int w, int a) const {
+    // a — предок w, а на пути к корню глубина задаёт вершину однозначно
+    auto begin = point_depths.begin() + point_offsets[pre[w]];
+    auto end = point_depths.begin() + point_offsets[pre[w] + 1];
+    return std::count(begin, end, depth[a]);
+}
+
+std::vector<FailureImpact> FailureBatch::analyze(const std::vector<FailureSet>& scenarios) {
+    STATS_CLOCK(stats);
+    // Слот — пара кусков (нижний, верхний) и число рёбер между ними.
+    // Префиксный запрос: точки с pre <= x и глубиной в [low, high].
+    struct PrefixQuery {
+        int x;
+        int low;
+        int high;
+        int slot;
+        int sign;
+    };
+    struct Scenario {
+        int first_piece;
+        std::vector<int> tops;
+        std::vector<int> touched;
+    };
+    std::vector<Scenario> plans(scenarios.size());
+    std::vector<long long> slot_count;
+    std::vector<std::pair<int, int>> slot_pieces;
+    std::vector<PrefixQuery> queries;
+    int pieces = 0;
+
+    for (size_t s = 0; s < scenarios.size(); ++s) {
+        Scenario& plan = plans[s];
+        std::vector<int> failed = scenarios[s].vertices;
+        std::sort(failed.begin(), failed.end());
+        failed.erase(std::unique(failed.begin(), failed.end()), failed.end());
+        auto is_failed = [&](int v) { return std::binary_search(failed.begin(), failed.end(), v); };
+
+        // Рёбра — точки (pre нижнего конца, глубина верхнего); оборванное
+        // ребро дерева ещё и режет дерево под своим нижним концом.
+        std::vector<std::pair<int, int>> failed_points;
+        std::vector<std::pair<int, int>> failed_arcs;
+        std::vector<int> cut = failed;
+        for (auto [u, v] : scenarios[s].edges) {
+            if (u == v || is_failed(u) || is_failed(v)) continue;
+            int w = pre[u] > pre[v] ? u : v;
+            int a = w == u ? v : u;
+            if (!in_subtree(a, w)) continue;
+            int copies = std::count(failed_arcs.begin(), failed_arcs.end(), std::make_pair(w, a));
+            if (copies >= multiplicity(w, a)) continue;
+            failed_arcs.push_back({w, a});
+            failed_points.push_back({pre[w], depth[a]});
+            if (parent[w] == a) cut.push_back(w);
+        }
+        std::sort(cut.begin(), cut.end(), [&](int a, int b) { return pre[a] < pre[b]; });
+        cut.erase(std::unique(cut.begin(), cut.end()), cut.end());
+
+        // Верхушки кусков: корни затронутых компонент, дети отказавших
+        // вершин и нижние концы оборванных рёбер дерева.
+        for (int k : cut) plan.touched.push_back(root[k]);
+        std::sort(plan.touched.begin(), plan.touched.end());
+        plan.touched.erase(std::unique(plan.touched.begin(), plan.touched.end()), plan.touched.end());
+        for (int r : plan.touched) {
+            if (!is_failed(r)) plan.tops.push_back(r);
+        }
+        for (int k : cut) {
+            if (is_failed(k)) {
+                for (int i = child_offsets[k]; i < child_offsets[k + 1]; ++i) {
+                    if (!is_failed(children[i])) plan.tops.push_back(children[i]);
+                }
+            } else if (!is_failed(parent[k])) {
+                plan.tops.push_back(k);
+            }
+        }
+        std::sort(plan.tops.begin(), plan.tops.end());
+        plan.tops.erase(std::unique(plan.tops.begin(), plan.tops.end()), plan.tops.end());
+        plan.first_piece = pieces;
+        pieces += plan.tops.size();
+        auto piece_of = [&](int top) {
+            return plan.first_piece + static_cast<int>(std::lower_bound(plan.tops.begin(), plan.tops.end(), top) -
+                                                       plan.tops.begin());
+        };
+
+        std::vector<std::pair<int, int>> intervals;
+        std::vector<int> ancestors;
+        for (int t : plan.tops) {
+            // отрезок поддерева t без поддеревьев разрезов ниже t
+            intervals.clear();
+            int from = pre[t];
+            for (int k : cut) {
+                if (pre[k] <= pre[t] || !in_subtree(t, k) || pre[k] < from) continue;
+                if (pre[k] > from) intervals.push_back({from, pre[k] - 1});
+                from = last[k] + 1;
+            }
+            if (from <= last[t]) intervals.push_back({from, last[t]});
+
+            // Путь к корню делится разрезами на участки глубин; участок
+            // принадлежит куску разреза над ним (или куску корня).
+            ancestors.clear();
+            for (int k : cut) {
+                if (k != t && in_subtree(k, t)) ancestors.push_back(k);
+            }
+            int owner = root[t];
+            int low = 0;
+            for (size_t i = 0; i <= ancestors.size(); ++i) {
+                int high = (i < ancestors.size() ? depth[ancestors[i]] : depth[t]) - 1;
+                if (low <= high) {
+                    int slot = slot_count.size();
+                    long long count = 0;
+                    for (auto [x, d] : failed_points) {
+                        if (d < low || d > high) continue;
+                        for (auto [l, r] : intervals) {
+                            if (l <= x && x <= r) count--;
+                        }
+                    }
+                    slot_count.push_back(count);
+                    slot_pieces.push_back({piece_of(t), piece_of(owner)});
+                    for (auto [l, r] : intervals) {
+                        queries.push_back({r, low, high, slot, 1});
+                        if (l > 0) queries.push_back({l - 1, low, high, slot, -1});
+                    }
+                }
+                if (i == ancestors.size()) break;
+                int k = ancestors[i];
+                if (is_failed(k)) {
+                    owner = child_towards(k, t);
+                    low = depth[k] + 1;
+                } else {
+                    owner = k;
+                    low = depth[k];
+                }
+            }
+        }
+    }
+    STATS_ADD(stats, "scenarios", scenarios.size());
+    STATS_ADD(stats, "pieces", pieces);
+    STATS_ADD(stats, "rectangle_queries", queries.size());
+    STATS_LAP("plan");
+
+    // Проход по pre с деревом Фенвика по глубинам.
+    std::sort(queries.begin(), queries.end(), [](const PrefixQuery& a, const PrefixQuery& b) { return a.x < b.x; });
+    std::vector<int> fenwick(n + 1, 0);
+    auto prefix = [&](int d) {
+        int sum = 0;
+        for (int i = d + 1; i > 0; i -= i & -i) sum += fenwick[i];
+        return sum;
+    };
+    size_t next = 0;
+    for (int x = 0; x < n && next < queries.size(); ++x) {
+        for (int i = point_offsets[x]; i < point_offsets[x + 1]; ++i) {
+            for (int j = point_depths[i] + 1; j <= n; j += j & -j) fenwick[j]++;
+        }
+        for (; next < queries.size() && queries[next].x == x; ++next) {
+            const PrefixQuery& q = queries[next];
+            slot_count[q.slot] += q.sign * (prefix(q.high) - prefix(q.low - 1));
+        }
+    }
+    STATS_LAP("sweep");
+
+    UnionFind groups(pieces);
+    for (size_t slot = 0; slot < slot_count.size(); ++slot) {
+        if (slot_count[slot] > 0) groups.unite(slot_pieces[slot].first, slot_pieces[slot].second);
+    }
+    std::vector<FailureImpact> result(scenarios.size());
+    std::vector<std::pair<int, int>> labels;
+    for (size_t s = 0; s < scenarios.size(); ++s) {
+        const Scenario& plan = plans[s];
+        labels.clear();
+        for (size_t i = 0; i < plan.tops.size(); ++i) {
+            labels.push_back({root[plan.tops[i]], groups.find(plan.first_piece + i)});
+        }
+        std::sort(labels.begin(), labels.end());
+        labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+        bool disconnects = false;
+        for (size_t i = 1; i < labels.size(); ++i) {
+            if (labels[i].first == labels[i - 1].first) disconnects = true;
+        }
+        result[s] = {components - static_cast<int>(plan.touched.size()) + static_cast<int>(labels.size()),
+                     disconnects};
+    }
+    STATS_LAP("merge");
+    return result;
+}
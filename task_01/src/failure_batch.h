@@ -0,0 +1,64 @@
+#ifndef FAILURE_BATCH_H
+#define FAILURE_BATCH_H
+
+#include <utility>
+#include <vector>
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
+
+// Набор одновременных отказов: роутеры и кабели. Кабель, заданный
+// несколько раз, — несколько параллельных кабелей между теми же роутерами.
+struct FailureSet {
+    std::vector<int> vertices;
+    std::vector<std::pair<int, int>> edges;
+};
+
+struct FailureImpact {
+    // компонент связности среди уцелевших роутеров
+    int components;
+    // какая-то из затронутых компонент распалась на части
+    bool disconnects;
+};
+
+// Пакетный анализ «что если» для небольших наборов отказов (2–3 элемента).
+// Один обход в глубину на весь пакет: рёбра графа хранятся точками
+// (pre нижнего конца, глубина верхнего) — в дереве обхода все рёбра идут
+// между предком и потомком. Отказы режут дерево на куски — отрезки pre без
+// вложенных поддеревьев; кусок связан с куском выше, если в прямоугольнике
+// «его отрезки × глубины того куска на пути к корню» есть точка. Все
+// прямоугольники пакета считаются разом одним проходом с деревом Фенвика,
+// после чего куски каждого сценария склеиваются системой множеств.
+class FailureBatch {
+public:
+    explicit FailureBatch(const CSRGraph& graph);
+
+    int component_count() const { return components; }
+
+    std::vector<FailureImpact> analyze(const std::vector<FailureSet>& scenarios);
+
+    SolverStats get_stats() const { return stats; }
+
+private:
+    int n;
+    int components = 0;
+    std::vector<int> parent;
+    std::vector<int> pre;
+    std::vector<int> last;
+    std::vector<int> depth;
+    std::vector<int> root;
+    // дети каждой вершины в порядке pre
+    std::vector<int> child_offsets;
+    std::vector<int> children;
+    // глубины верхних концов рёбер, сгруппированные по pre нижнего конца
+    std::vector<int> point_offsets;
+    std::vector<int> point_depths;
+
+    SolverStats stats{"failure_batch"};
+
+    bool in_subtree(int top, int v) const { return pre[top] <= pre[v] && pre[v] <= last[top]; }
+    int child_towards(int ancestor, int v) const;
+    // число рёбер между w и его предком a
+    int multiplicity(int w, int a) const;
+};
+
+#endif
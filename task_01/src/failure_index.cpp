@@ -0,0 +1,224 @@
+#include "failure_index.h"
+#include <algorithm>
+#include <bit>
+#include "dfs.hpp"
+
+FailureIndex::FailureIndex(const CSRGraph& graph) : n(graph.vertex_count()) {
+    build_tarjan(graph);
+    build_block_tree();
+}
+
+void FailureIndex::build_tarjan(const CSRGraph& graph) {
+    STATS_PHASE(stats, "tarjan");
+    tin.assign(n, -1);
+    tout.assign(n, -1);
+    parent.assign(n, -1);
+    low.assign(n, -1);
+    component.assign(n, -1);
+    two_edge_id.assign(n, -1);
+    block_offsets.assign(1, 0);
+    block_members.clear();
+
+    // Один проход Тарьяна с двумя стеками вершин: блок снимается со стека,
+    // когда low[to] >= tin[v], компонента рёберной двусвязности — когда
+    // low[to] > tin[v] (ребро v-to — мост)
+    struct Visitor : DfsVisitor {
+        FailureIndex& index;
+        std::vector<int> block_stack;
+        std::vector<int> edge_stack;
+        // дуга к родителю пропускается один раз: её копия — обратное ребро
+        std::vector<char> parent_skipped;
+        int timer = 0;
+        int root = -1;
+        int root_children = 0;
+        STATS_ONLY(uint64_t arcs = 0;)
+
+        explicit Visitor(FailureIndex& index) : index(index), parent_skipped(index.n, 0) {
+            block_stack.reserve(index.n);
+            edge_stack.reserve(index.n);
+        }
+
+        void enter(int v, int p) {
+            index.parent[v] = p;
+            index.tin[v] = index.low[v] = timer++;
+            index.component[v] = root;
+            block_stack.push_back(v);
+            edge_stack.push_back(v);
+        }
+
+        void non_tree_edge(int v, int to, bool) {
+            STATS_ONLY(++arcs;)
+            if (to == index.parent[v] && !parent_skipped[v]) {
+                parent_skipped[v] = 1;
+                return;
+            }
+            index.low[v] = std::min(index.low[v], index.tin[to]);
+        }
+
+        void leave(int v, int) { index.tout[v] = timer; }
+
+        void tree_edge(int v, int to) {
+            STATS_ONLY(++arcs;)
+            index.low[v] = std::min(index.low[v], index.low[to]);
+            if (index.low[to] >= index.tin[v]) {
+                int w;
+                do {
+                    w = block_stack.back();
+                    block_stack.pop_back();
+                    index.block_members.push_back(w);
+                } while (w != to);
+                index.block_members.push_back(v);
+                index.block_offsets.push_back(static_cast<int>(index.block_members.size()));
+            }
+            if (index.low[to] > index.tin[v]) {
+                close_two_edge(to);
+            }
+            if (v == root) root_children++;
+        }
+
+        void close_two_edge(int last) {
+            int w;
+            do {
+                w = edge_stack.back();
+                edge_stack.pop_back();
+                index.two_edge_id[w] = index.two_edge_count;
+            } while (w != last);
+            index.two_edge_count++;
+        }
+    };
+
+    Visitor visitor(*this);
+    DfsEngine dfs(n);
+    for (int i = 0; i < n; ++i) {
+        if (dfs.visited(i)) continue;
+        STATS_ADD(stats, "dfs_roots", 1);
+        visitor.root = i;
+        visitor.root_children = 0;
+        dfs.run(graph, i, visitor);
+        // корень остаётся на стеке блоков: все его блоки уже закрыты
+        visitor.block_stack.pop_back();
+        if (visitor.root_children == 0) {
+            block_members.push_back(i);
+            block_offsets.push_back(static_cast<int>(block_members.size()));
+        }
+        visitor.close_two_edge(i);
+    }
+    STATS_ADD(stats, "vertices_visited", n);
+    STATS_ADD(stats, "arcs_scanned", visitor.arcs);
+    STATS_ADD(stats, "blocks", block_count());
+    STATS_ADD(stats, "two_edge_components", two_edge_count);
+}
+
+void FailureIndex::build_block_tree() {
+    STATS_PHASE(stats, "block_tree");
+    int blocks = block_count();
+
+    // точка сочленения — вершина, входящая больше чем в один блок
+    std::vector<int> membership(n, 0);
+    node_of.assign(n, -1);
+    for (int b = 0; b < blocks; ++b) {
+        for (int v : block_vertices(b)) {
+            membership[v]++;
+            node_of[v] = b;
+        }
+    }
+    cut_node.assign(n, -1);
+    int nodes = blocks;
+    for (int v = 0; v < n; ++v) {
+        if (membership[v] > 1) {
+            cut_node[v] = nodes++;
+            node_of[v] = cut_node[v];
+        }
+    }
+    STATS_ADD(stats, "cut_vertices", nodes - blocks);
+
+    EdgeList tree_edges(nodes);
+    for (int b = 0; b < blocks; ++b) {
+        for (int v : block_vertices(b)) {
+            if (cut_node[v] != -1) tree_edges.add(b, cut_node[v]);
+        }
+    }
+    CSRGraph tree = CSRGraph::from_edges(tree_edges, false);
+
+    // Порядок входа в дерево блоков; для LCA на позиции i хранится tree_tin
+    // родителя узла tree_order[i]: LCA(a, b) при tin[a] < tin[b] — узел с
+    // минимальным таким значением на (tin[a], tin[b]]
+    struct Visitor : DfsVisitor {
+        FailureIndex& index;
+        std::vector<int> parent_tin;
+        int timer = 0;
+
+        Visitor(FailureIndex& index, int nodes) : index(index), parent_tin(nodes, 0) {}
+
+        void enter(int v, int p) {
+            index.tree_tin[v] = timer;
+            index.tree_order[timer] = v;
+            parent_tin[timer] = p == -1 ? timer : index.tree_tin[p];
+            timer++;
+        }
+
+        void leave(int v, int) { index.tree_tout[v] = timer; }
+    };
+
+    tree_tin.assign(nodes, -1);
+    tree_tout.assign(nodes, -1);
+    tree_order.assign(nodes, -1);
+    Visitor visitor(*this, nodes);
+    DfsEngine dfs(nodes);
+    for (int i = 0; i < nodes; ++i) {
+        if (!dfs.visited(i)) dfs.run(tree, i, visitor);
+    }
+
+    lca_table.clear();
+    lca_table.push_back(std::move(visitor.parent_tin));
+    for (int k = 1; (1 << k) <= nodes; ++k) {
+        const std::vector<int>& prev = lca_table[k - 1];
+        std::vector<int> level(nodes - (1 << k) + 1);
+        for (size_t i = 0; i < level.size(); ++i) {
+            level[i] = std::min(prev[i], prev[i + (1 << (k - 1))]);
+        }
+        lca_table.push_back(std::move(level));
+    }
+}
+
+int FailureIndex::tree_lca(int a, int b) const {
+    if (a == b) return a;
+    int l = tree_tin[a];
+    int r = tree_tin[b];
+    if (l > r) std::swap(l, r);
+    ++l;
+    int k = std::bit_width(static_cast<unsigned>(r - l + 1)) - 1;
+    return tree_order[std::min(lca_table[k][l], lca_table[k][r - (1 << k) + 1])];
+}
+
+int FailureIndex::bridge_child(int u, int v) const {
+    if (u == v) return -1;
+    int child = -1;
+    if (parent[v] == u) {
+        child = v;
+    } else if (parent[u] == v) {
+        child = u;
+    }
+    // ребро дерева DFS — мост, если из поддерева нет другого пути наверх
+    if (child == -1 || low[child] <= tin[parent[child]]) return -1;
+    return child;
+}
+
+bool FailureIndex::connected_without_vertex(int a, int b, int x) const {
+    if (a == x || b == x) return false;
+    if (!connected(a, b)) return false;
+    if (a == b || !is_articulation_point(x)) return true;
+    // a и b разделены, если узел x лежит на пути между их узлами в дереве блоков
+    int na = node_of[a];
+    int nb = node_of[b];
+    int cut = cut_node[x];
+    int lca = tree_lca(na, nb);
+    return !(tree_ancestor(lca, cut) && (tree_ancestor(cut, na) || tree_ancestor(cut, nb)));
+}
+
+bool FailureIndex::connected_without_edge(int a, int b, int u, int v) const {
+    if (!connected(a, b)) return false;
+    int child = bridge_child(u, v);
+    if (child == -1) return true;
+    return in_subtree(child, a) == in_subtree(child, b);
+}
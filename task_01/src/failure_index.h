@@ -0,0 +1,84 @@
+#ifndef FAILURE_INDEX_H
+#define FAILURE_INDEX_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
+
+// Индекс для запросов «останутся ли a и b связаны, если откажет один роутер
+// или один кабель». Строится одним проходом Тарьяна, который сразу выделяет
+// блоки (компоненты вершинной двусвязности) и компоненты рёберной
+// двусвязности. По блокам строится дерево блоков и точек сочленения, на нём —
+// LCA через разреженную таблицу, поэтому каждый запрос отвечает за O(1).
+// Кратные рёбра учитываются: ребро, продублированное кабелем, не мост.
+class FailureIndex {
+public:
+    explicit FailureIndex(const CSRGraph& graph);
+
+    int vertex_count() const { return n; }
+
+    // Связны ли a и b в исходном графе.
+    bool connected(int a, int b) const { return component[a] == component[b]; }
+    // Связны ли a и b после удаления вершины x (a, b != x).
+    bool connected_without_vertex(int a, int b, int x) const;
+    // Связны ли a и b после удаления одного ребра u-v (для кратного ребра —
+    // одной его копии).
+    bool connected_without_edge(int a, int b, int u, int v) const;
+
+    bool is_articulation_point(int v) const { return cut_node[v] != -1; }
+    bool is_bridge(int u, int v) const { return bridge_child(u, v) != -1; }
+
+    // Компоненты рёберной двусвязности: вершины связаны и после удаления
+    // любого одного ребра тогда и только тогда, когда номера совпадают.
+    int two_edge_component(int v) const { return two_edge_id[v]; }
+    int two_edge_component_count() const { return two_edge_count; }
+
+    // Блоки: максимальные двусвязные подграфы (отдельное ребро-мост и
+    // изолированная вершина тоже блоки). Точка сочленения входит в несколько.
+    int block_count() const { return static_cast<int>(block_offsets.size()) - 1; }
+    std::span<const int> block_vertices(int block) const {
+        return std::span<const int>(block_members).subspan(block_offsets[block],
+                                                           block_offsets[block + 1] - block_offsets[block]);
+    }
+
+    SolverStats get_stats() const { return stats; }
+
+private:
+    int n;
+    // DFS по графу: время входа, граница поддерева и родитель
+    std::vector<int> tin;
+    std::vector<int> tout;
+    std::vector<int> parent;
+    std::vector<int> low;
+    std::vector<int> component;
+    std::vector<int> two_edge_id;
+    int two_edge_count = 0;
+
+    std::vector<int> block_offsets;
+    std::vector<int> block_members;
+
+    // Дерево блоков: узлы 0..B-1 — блоки, B.. — точки сочленения.
+    // node_of[v] — узел точки сочленения v или единственный блок с v.
+    std::vector<int> cut_node;
+    std::vector<int> node_of;
+    std::vector<int> tree_tin;
+    std::vector<int> tree_tout;
+    std::vector<int> tree_order;
+    // lca_table[k][i] — минимальное tree_tin родителя на [i, i + 2^k)
+    std::vector<std::vector<int>> lca_table;
+
+    SolverStats stats{"failure_index"};
+
+    void build_tarjan(const CSRGraph& graph);
+    void build_block_tree();
+    int bridge_child(int u, int v) const;
+    bool in_subtree(int root, int v) const { return tin[root] <= tin[v] && tin[v] < tout[root]; }
+    bool tree_ancestor(int root, int node) const {
+        return tree_tin[root] <= tree_tin[node] && tree_tin[node] < tree_tout[root];
+    }
+    int tree_lca(int a, int b) const;
+};
+
+#endif
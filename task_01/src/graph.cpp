@@ -1,70 +1,244 @@
 #include "graph.h"
 #include <algorithm>
+#include <atomic>
+#include <span>
+#include "concurrent_union_find.hpp"
+#include "dfs.hpp"
+#include "parallel.hpp"
+#include "parallel_critical.h"
 
-Graph::Graph(int vertices) : n(vertices), timer(0) {
-    adj.resize(n);
+namespace {
+
+// Меньше дуг на поток не окупают запуск потоков на каждом шаге.
+constexpr int kMinArcsPerThread = 1 << 17;
+
+// Тарьян: low[v] — минимальное время входа, достижимое из поддерева v
+// одной обратной дугой. Времена сравниваются только внутри компоненты,
+// поэтому разные компоненты можно обходить разными визиторами над общими
+// массивами.
+struct TarjanVisitor : DfsVisitor {
+    std::span<int> tin;
+    std::span<int> low;
+    std::span<int> parent;
+    std::vector<int>& articulation_points;
+    std::vector<std::pair<int, int>>& bridges;
+    int timer = 0;
+    int root = -1;
+    int root_children = 0;
+    STATS_ONLY(uint64_t arcs = 0;)
+
+    TarjanVisitor(std::span<int> tin, std::span<int> low, std::span<int> parent,
+                  std::vector<int>& articulation_points, std::vector<std::pair<int, int>>& bridges)
+        : tin(tin), low(low), parent(parent), articulation_points(articulation_points), bridges(bridges) {}
+
+    void enter(int v, int p) {
+        parent[v] = p;
+        tin[v] = low[v] = timer++;
+    }
+
+    // Дуга к родителю пропускается один раз, как в остальных движках: её
+    // копия — обратное ребро, и двойной кабель не мост. После пропуска
+    // parent[v] сбрасывается, он нужен только здесь.
+    void non_tree_edge(int v, int to, bool) {
+        STATS_ONLY(++arcs;)
+        if (to == parent[v]) {
+            parent[v] = -1;
+            return;
+        }
+        low[v] = std::min(low[v], tin[to]);
+    }
+
+    void tree_edge(int v, int to) {
+        STATS_ONLY(++arcs;)
+        low[v] = std::min(low[v], low[to]);
+        if (low[to] >= tin[v] && v != root) {
+            articulation_points.push_back(v);
+        }
+        if (low[to] > tin[v]) {
+            bridges.push_back({std::min(v, to), std::max(v, to)});
+        }
+        if (v == root) root_children++;
+    }
+
+    // Обходит компоненту root целиком.
+    void run(DfsEngine& dfs, const CSRGraph& graph, int start) {
+        root = start;
+        root_children = 0;
+        dfs.run(graph, start, *this);
+        if (root_children > 1) articulation_points.push_back(start);
+    }
+};
+
+}  // namespace
+
+Graph::Graph(int vertices, Arena* scratch) : n(vertices), edges(vertices), adj_dirty(true), scratch(scratch) {
+}
+
+Graph::Graph(const CSRGraph& graph, Arena* scratch)
+    : n(graph.vertex_count()), edges(graph.vertex_count()), adj(graph), adj_dirty(false), scratch(scratch) {
 }
 
 void Graph::add_edge(int u, int v) {
     if (u == v) return;
-    adj[u].push_back(v);
-    adj[v].push_back(u);
+    if (edges.empty() && adj.arc_count() > 0) {
+        // граф был передан готовым CSR: восстанавливаем список рёбер
+        edges = adj.to_edge_list();
+    }
+    edges.add(u, v);
+    adj_dirty = true;
+    if (incremental) {
+        STATS_ADD(stats, "incremental_edges", 1);
+        incremental->add_edge(u, v);
+    }
 }
 
-void Graph::dfs(int v, int parent) {
-    visited[v] = true;
-    tin[v] = low[v] = timer++;
-    int children = 0;
-    
-    for (int to : adj[v]) {
-        if (to == parent) continue;
-        
-        if (visited[to]) {
-            low[v] = std::min(low[v], tin[to]);
-        } else {
-            dfs(to, v);
-            low[v] = std::min(low[v], low[to]);
-            
-            if (low[to] >= tin[v] && parent != -1) {
-                articulation_points.push_back(v);
-            }
-            
-            if (low[to] > tin[v]) {
-                bridges.push_back({std::min(v, to), std::max(v, to)});
-            }
-            
-            children++;
-        }
-    }
-    
-    if (parent == -1 && children > 1) {
-        articulation_points.push_back(v);
+void Graph::track_incrementally() {
+    if (incremental) return;
+    STATS_PHASE(stats, "track_incrementally");
+    incremental = std::make_unique<IncrementalBridges>(n);
+    if (edges.empty() && adj.arc_count() > 0) edges = adj.to_edge_list();
+    for (int i = 0; i < edges.size(); ++i) {
+        incremental->add_edge(edges.from[i], edges.to[i]);
     }
 }
 
+void Graph::build_adjacency() {
+    if (!adj_dirty) return;
+    STATS_PHASE(stats, "build_adjacency");
+    adj = CSRGraph::from_edges(edges, false);
+    adj_dirty = false;
+}
+
 void Graph::find_critical_elements() {
-    timer = 0;
-    visited.assign(n, false);
-    tin.assign(n, -1);
-    low.assign(n, -1);
+    if (incremental) return;
+    build_adjacency();
+    STATS_PHASE(stats, "dfs");
+    ScratchScope scope(scratch);
     articulation_points.clear();
     bridges.clear();
-    
+
+    std::pmr::vector<int> tin(n, -1, scope.resource());
+    std::pmr::vector<int> low(n, -1, scope.resource());
+    std::pmr::vector<int> parent(n, -1, scope.resource());
+    TarjanVisitor visitor(tin, low, parent, articulation_points, bridges);
+    DfsEngine dfs(scope.resource());
+    dfs.reset(n);
     for (int i = 0; i < n; ++i) {
-        if (!visited[i]) {
-            dfs(i, -1);
+        if (!dfs.visited(i)) {
+            STATS_ADD(stats, "dfs_roots", 1);
+            visitor.run(dfs, adj, i);
         }
     }
-    
+    STATS_ADD(stats, "vertices_visited", n);
+    STATS_ADD(stats, "arcs_scanned", visitor.arcs);
+
     std::sort(articulation_points.begin(), articulation_points.end());
     articulation_points.erase(std::unique(articulation_points.begin(), articulation_points.end()), articulation_points.end());
     std::sort(bridges.begin(), bridges.end());
 }
 
+FailureIndex Graph::build_failure_index() {
+    build_adjacency();
+    return FailureIndex(adj);
+}
+
+std::vector<FailureImpact> Graph::analyze_failures(const std::vector<FailureSet>& scenarios) {
+    build_adjacency();
+    FailureBatch batch(adj);
+    return batch.analyze(scenarios);
+}
+
+void Graph::find_critical_elements_parallel(unsigned threads) {
+    if (incremental) return;
+    build_adjacency();
+    if (threads == 0) threads = default_thread_count();
+    threads = std::min<unsigned>(threads, adj.arc_count() / kMinArcsPerThread);
+    if (threads <= 1) {
+        find_critical_elements();
+        return;
+    }
+    STATS_PHASE(stats, "parallel");
+    STATS_ADD(stats, "threads", threads);
+    ::find_critical_elements_parallel(adj, threads, articulation_points, bridges, stats);
+}
+
+void Graph::find_critical_elements_by_component(unsigned threads) {
+    if (incremental) return;
+    build_adjacency();
+    if (threads == 0) threads = default_thread_count();
+    STATS_PHASE(stats, "by_component");
+    STATS_CLOCK(stats);
+    articulation_points.clear();
+    bridges.clear();
+    auto offsets = adj.offsets();
+    auto targets = adj.targets();
+
+    // Разметка компонент: корень множества — наименьшая вершина компоненты,
+    // с неё и начинается обход.
+    ConcurrentUnionFind components(n);
+    parallel_vertex_blocks(offsets, threads, [&](unsigned, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            for (uint32_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+                if (v < static_cast<int>(targets[i])) components.unite(v, targets[i]);
+            }
+        }
+    });
+    std::vector<int> size(n, 0);
+    for (int v = 0; v < n; ++v) {
+        size[components.find(v)]++;
+    }
+    std::vector<int> roots;
+    for (int v = 0; v < n; ++v) {
+        if (size[v] > 1) roots.push_back(v);
+    }
+    // большие компоненты первыми, чтобы последние задачи были короткими
+    std::stable_sort(roots.begin(), roots.end(), [&](int a, int b) { return size[a] > size[b]; });
+    STATS_ADD(stats, "components", roots.size());
+    STATS_LAP("label_components");
+
+    // Компоненты не пересекаются, поэтому потоки пишут в общие tin/low/parent
+    // без гонок. Задачи раздаются через общий счётчик: они независимы и не
+    // порождают новых, так что очередей с кражей работы не требуется.
+    std::vector<int> tin(n, -1);
+    std::vector<int> low(n, -1);
+    std::vector<int> parent(n, -1);
+    // Цвета обхода тоже общие; стек потока растёт до самой большой из
+    // доставшихся ему компонент, а не до n.
+    std::vector<uint8_t> colors(n, DfsEngine::kWhite);
+    std::vector<std::vector<int>> part_points(threads);
+    std::vector<std::vector<std::pair<int, int>>> part_bridges(threads);
+    std::atomic<size_t> next_root{0};
+    parallel_blocks(threads, threads, [&](unsigned part, size_t, size_t) {
+        TarjanVisitor visitor(tin, low, parent, part_points[part], part_bridges[part]);
+        DfsEngine dfs(colors);
+        for (size_t k = next_root++; k < roots.size(); k = next_root++) {
+            dfs.reserve_stack(size[roots[k]]);
+            visitor.run(dfs, adj, roots[k]);
+        }
+        std::vector<int>& points = part_points[part];
+        std::sort(points.begin(), points.end());
+        points.erase(std::unique(points.begin(), points.end()), points.end());
+        std::sort(part_bridges[part].begin(), part_bridges[part].end());
+    });
+    STATS_LAP("dfs");
+
+    for (unsigned part = 0; part < threads; ++part) {
+        size_t middle = articulation_points.size();
+        articulation_points.insert(articulation_points.end(), part_points[part].begin(), part_points[part].end());
+        std::inplace_merge(articulation_points.begin(), articulation_points.begin() + middle, articulation_points.end());
+        middle = bridges.size();
+        bridges.insert(bridges.end(), part_bridges[part].begin(), part_bridges[part].end());
+        std::inplace_merge(bridges.begin(), bridges.begin() + middle, bridges.end());
+    }
+    STATS_LAP("merge");
+}
+
 std::vector<int> Graph::get_articulation_points() const {
+    if (incremental) return incremental->articulation_points();
     return articulation_points;
 }
 
 std::vector<std::pair<int, int>> Graph::get_bridges() const {
+    if (incremental) return incremental->bridges();
     return bridges;
 }
\ No newline at end of file
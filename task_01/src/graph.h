@@ -1,28 +1,54 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <memory>
 #include <vector>
 #include <set>
+#include "arena.hpp"
+#include "csr_graph.hpp"
+#include "failure_batch.h"
+#include "failure_index.h"
+#include "incremental_bridges.h"
+#include "solver_stats.hpp"
 
 class Graph {
 public:
-    Graph(int vertices);
+    // scratch — арена для временных буферов обхода; nullptr — обычная куча
+    Graph(int vertices, Arena* scratch = nullptr);
+    Graph(const CSRGraph& graph, Arena* scratch = nullptr);
     void add_edge(int u, int v);
     void find_critical_elements();
+    // То же параллельно (parallel_critical.h) на threads потоках, 0 — все
+    // ядра; на малых графах — последовательный Тарьян.
+    void find_critical_elements_parallel(unsigned threads = 0);
+    // Для графов из множества компонент: компоненты размечаются системой
+    // множеств и обходятся последовательным Тарьяном одновременно.
+    void find_critical_elements_by_component(unsigned threads = 0);
+    // Дальше add_edge поддерживает мосты и точки сочленения на лету
+    // (IncrementalBridges), get_* возвращают текущее состояние без обхода,
+    // а find_critical_elements ничего не пересчитывает.
+    void track_incrementally();
     std::vector<int> get_articulation_points() const;
     std::vector<std::pair<int, int>> get_bridges() const;
+    // Индекс для запросов связности при отказе одной вершины или ребра;
+    // после add_edge его нужно построить заново.
+    FailureIndex build_failure_index();
+    // Пакет сценариев одновременных отказов (FailureBatch).
+    std::vector<FailureImpact> analyze_failures(const std::vector<FailureSet>& scenarios);
+    SolverStats get_stats() const { return stats; }
 
 private:
     int n;
-    std::vector<std::vector<int>> adj;
-    std::vector<bool> visited;
-    std::vector<int> tin;
-    std::vector<int> low;
-    int timer;
+    EdgeList edges;
+    CSRGraph adj;
+    bool adj_dirty;
+    Arena* scratch;
     std::vector<int> articulation_points;
     std::vector<std::pair<int, int>> bridges;
+    std::unique_ptr<IncrementalBridges> incremental;
+    SolverStats stats{"critical_elements"};
     
-    void dfs(int v, int parent);
+    void build_adjacency();
 };
 
-#endif
\ No newline at end of file
+#endif
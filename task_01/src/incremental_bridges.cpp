@@ -0,0 +1,163 @@
+#include "incremental_bridges.h"
+#include <algorithm>
+
+IncrementalBridges::IncrementalBridges(int vertices)
+    : n(vertices),
+      parent(vertices, -1),
+      forest(vertices),
+      trees(vertices),
+      two_edge(vertices),
+      blocks(vertices),
+      block_top(vertices, -1),
+      block_cycle(vertices, 0),
+      top_count(vertices, 0),
+      mark(vertices, 0),
+      mark_side(vertices, 0),
+      label_first(vertices, -1) {
+}
+
+void IncrementalBridges::add_edge(int u, int v) {
+    if (u == v) return;
+    if (trees.same(u, v)) {
+        merge_path(u, v);
+    } else {
+        link(u, v);
+    }
+}
+
+void IncrementalBridges::link(int u, int v) {
+    if (trees.set_size(u) > trees.set_size(v)) std::swap(u, v);
+    reroot(u);
+    parent[u] = v;
+    forest[u].push_back(v);
+    forest[v].push_back(u);
+    blocks.isolate(u);
+    block_top[u] = v;
+    block_cycle[u] = 0;
+    top_count[v]++;
+    bridges_count++;
+    trees.unite(u, v);
+}
+
+void IncrementalBridges::reroot(int root) {
+    if (parent[root] == -1) return;
+
+    // Блоки — множества рёбер и от корня не зависят, меняются только ключи
+    // рёбер на пути к старому корню и верхние вершины. Запоминаем блок
+    // каждого ребра под старым ключом и раскладываем заново в порядке
+    // обхода в ширину: первое ребро блока в этом порядке — самое верхнее.
+    std::vector<int> order = {root};
+    std::vector<int> new_parent = {-1};
+    std::vector<int> label = {-1};
+    for (size_t head = 0; head < order.size(); ++head) {
+        int x = order[head];
+        for (int to : forest[x]) {
+            if (to == new_parent[head]) continue;
+            int key = parent[to] == x ? to : x;
+            order.push_back(to);
+            new_parent.push_back(x);
+            label.push_back(blocks.find(key));
+        }
+    }
+    std::vector<char> cycle(order.size(), 0);
+    for (size_t i = 1; i < order.size(); ++i) {
+        cycle[i] = block_cycle[label[i]];
+    }
+    for (size_t i = 0; i < order.size(); ++i) {
+        blocks.isolate(order[i]);
+        top_count[order[i]] = 0;
+        parent[order[i]] = new_parent[i];
+    }
+    for (size_t i = 1; i < order.size(); ++i) {
+        int x = order[i];
+        int& first = label_first[label[i]];
+        if (first == -1) {
+            first = x;
+            block_top[x] = parent[x];
+            block_cycle[x] = cycle[i];
+            top_count[parent[x]]++;
+        } else {
+            int top = block_top[blocks.find(first)];
+            int merged = blocks.unite(first, x);
+            block_top[merged] = top;
+            block_cycle[merged] = cycle[i];
+        }
+    }
+    for (size_t i = 1; i < order.size(); ++i) {
+        label_first[label[i]] = -1;
+    }
+}
+
+void IncrementalBridges::merge_path(int u, int v) {
+    // Поднимаемся от u и v по очереди, перескакивая блоки целиком, до первой
+    // вершины, которую уже прошла другая сторона.
+    ++stamp;
+    int current[2] = {u, v};
+    chain[0].assign(1, u);
+    chain[1].assign(1, v);
+    mark[u] = stamp;
+    mark_side[u] = 0;
+    mark[v] = stamp;
+    mark_side[v] = 1;
+    int meet = -1;
+    while (meet == -1) {
+        for (int side = 0; side < 2 && meet == -1; ++side) {
+            int x = current[side];
+            if (parent[x] == -1) continue;
+            int next = block_top[blocks.find(x)];
+            current[side] = next;
+            chain[side].push_back(next);
+            if (mark[next] == stamp && mark_side[next] != side) {
+                meet = next;
+            } else {
+                mark[next] = stamp;
+                mark_side[next] = side;
+            }
+        }
+    }
+
+    std::vector<int>& roots = merge_roots;
+    roots.clear();
+    for (auto& path : chain) {
+        for (int x : path) {
+            if (x == meet) break;
+            roots.push_back(blocks.find(x));
+        }
+    }
+    std::sort(roots.begin(), roots.end());
+    roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+
+    int merged = roots[0];
+    for (int root : roots) {
+        top_count[block_top[root]]--;
+        if (!block_cycle[root]) {
+            // ребро-мост — единственное ребро своего блока
+            bridges_count--;
+            two_edge.unite(root, parent[root]);
+        }
+        merged = blocks.unite(merged, root);
+    }
+    block_top[merged] = meet;
+    block_cycle[merged] = 1;
+    top_count[meet]++;
+}
+
+std::vector<int> IncrementalBridges::articulation_points() const {
+    std::vector<int> result;
+    for (int v = 0; v < n; ++v) {
+        if (is_articulation_point(v)) result.push_back(v);
+    }
+    return result;
+}
+
+std::vector<std::pair<int, int>> IncrementalBridges::bridges() const {
+    std::vector<std::pair<int, int>> result;
+    result.reserve(bridges_count);
+    for (int v = 0; v < n; ++v) {
+        if (parent[v] != -1 && !block_cycle[blocks.find(v)]) {
+            result.push_back({std::min(v, parent[v]), std::max(v, parent[v])});
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
@@ -0,0 +1,63 @@
+#ifndef INCREMENTAL_BRIDGES_H
+#define INCREMENTAL_BRIDGES_H
+
+#include <utility>
+#include <vector>
+#include "union_find.hpp"
+
+// Мосты, точки сочленения и компоненты рёберной двусвязности при
+// добавлении рёбер без повторного обхода графа.
+//
+// Хранится остовный лес с родителями. Рёбра леса (ребро v — parent[v]
+// обозначается вершиной v) объединены в блоки системой непересекающихся
+// множеств; у блока запоминается верхняя вершина и есть ли в нём цикл.
+// Ребро внутри дерева склеивает все блоки на пути между концами — подъём
+// идёт сразу по блокам, поэтому каждый шаг подъёма — это слияние.
+// Ребро между деревьями подвешивает меньшее дерево за конец и добавляет
+// мост. Амортизированно O(log n) на ребро.
+class IncrementalBridges {
+public:
+    explicit IncrementalBridges(int vertices);
+
+    void add_edge(int u, int v);
+
+    bool connected(int a, int b) const { return trees.same(a, b); }
+    int two_edge_component(int v) const { return two_edge.find(v); }
+    int bridge_count() const { return bridges_count; }
+
+    // Вершина — точка сочленения, если её рёбра леса лежат больше чем в одном блоке.
+    bool is_articulation_point(int v) const { return (parent[v] != -1) + top_count[v] >= 2; }
+
+    // Отсортированы так же, как у Graph.
+    std::vector<int> articulation_points() const;
+    std::vector<std::pair<int, int>> bridges() const;
+
+private:
+    int n;
+    std::vector<int> parent;
+    std::vector<std::vector<int>> forest;
+    mutable UnionFind trees;
+    mutable UnionFind two_edge;
+    // ключ — нижняя вершина ребра леса; данные лежат в корне множества
+    mutable UnionFind blocks;
+    std::vector<int> block_top;
+    std::vector<char> block_cycle;
+    // сколько блоков имеют вершину верхней
+    std::vector<int> top_count;
+    int bridges_count = 0;
+
+    // метки подъёма при поиске общей вершины
+    std::vector<int> mark;
+    std::vector<char> mark_side;
+    int stamp = 0;
+    std::vector<int> label_first;
+    // буферы merge_path, переиспользуются между рёбрами
+    std::vector<int> chain[2];
+    std::vector<int> merge_roots;
+
+    void link(int u, int v);
+    void reroot(int root);
+    void merge_path(int u, int v);
+};
+
+#endif
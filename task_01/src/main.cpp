@@ -1,57 +1,86 @@
-#include <iostream>
-#include <set>
 #include "graph.h"
+#include "edge_normalize.hpp"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "graph_file.hpp"
+#include "driver_args.hpp"
+#include "streaming_critical.h"
 
-int main() {
-    int n, m;
-    std::cin >> n >> m;
+CSRGraph read_graph(unsigned threads) {
+    FastReader in;
+    int n = in.read_int();
+    int m = in.read_int();
     
-    Graph g(n);
-    
-    std::set<std::pair<int, int>> unique_edges;
-    
-    for (int i = 0; i < m; ++i) {
-        int u, v;
-        std::cin >> u >> v;
-        u--; v--;
-        
-        if (u == v) continue;
-        
-        auto edge = std::make_pair(std::min(u, v), std::max(u, v));
-        if (unique_edges.find(edge) == unique_edges.end()) {
-            g.add_edge(u, v);
-            unique_edges.insert(edge);
+    EdgeList edges = read_edge_list(in, n, m, false, threads);
+    normalize_undirected(edges);
+    return CSRGraph::from_edges(edges, false, false, threads);
+}
+
+// Текстовый файл читается заново на каждом проходе; в памяти только O(n).
+StreamingCritical solve_streaming(const char* path) {
+    int n = FastReader(path).read_int();
+    StreamingCritical solver(n);
+    while (solver.pass() != -1) {
+        FastReader in(path);
+        in.read_int();
+        int m = in.read_int();
+        for (int i = 0; i < m; ++i) {
+            int u = in.read_int() - 1;
+            int v = in.read_int() - 1;
+            solver.edge(u, v);
         }
+        solver.finish_pass();
     }
+    return solver;
+}
+
+int main(int argc, char* argv[]) {
+    FastWriter out;
+    // --graph <file>: граф из бинарного файла (tools/graph_convert), без разбора текста;
+    // --stream <file>: список рёбер больше памяти, читается в несколько проходов
+    DriverArgs args(argc, argv);
     
-    g.find_critical_elements();
-    
-    std::vector<int> articulation_points = g.get_articulation_points();
-    std::vector<std::pair<int, int>> bridges = g.get_bridges();
+    std::vector<int> articulation_points;
+    std::vector<std::pair<int, int>> bridges;
+    SolverStats stats;
+    if (args.stream_path) {
+        StreamingCritical solver = solve_streaming(args.stream_path);
+        articulation_points = solver.get_articulation_points();
+        bridges = solver.get_bridges();
+        stats = solver.get_stats();
+    } else {
+        Graph g(args.graph_path ? load_graph_file(args.graph_path, false, false) : read_graph(args.threads));
+        g.find_critical_elements_parallel(args.threads);
+        articulation_points = g.get_articulation_points();
+        bridges = g.get_bridges();
+        stats = g.get_stats();
+    }
     
-    std::cout << articulation_points.size() << std::endl;
+    out << articulation_points.size() << '\n';
     
     if (articulation_points.empty()) {
-        std::cout << "-" << std::endl;
+        out << "-" << '\n';
     } else {
         for (size_t i = 0; i < articulation_points.size(); ++i) {
-            if (i > 0) std::cout << " ";
-            std::cout << articulation_points[i] + 1;
+            if (i > 0) out << " ";
+            out << articulation_points[i] + 1;
         }
-        std::cout << std::endl;
+        out << '\n';
     }
     
-    std::cout << bridges.size() << std::endl;
+    out << bridges.size() << '\n';
     
     if (bridges.empty()) {
-        std::cout << "-" << std::endl;
+        out << "-" << '\n';
     } else {
         for (size_t i = 0; i < bridges.size(); ++i) {
-            if (i > 0) std::cout << "; ";
-            std::cout << bridges[i].first + 1 << " " << bridges[i].second + 1;
+            if (i > 0) out << "; ";
+            out << bridges[i].first + 1 << " " << bridges[i].second + 1;
         }
-        std::cout << std::endl;
+        out << '\n';
     }
     
+    args.dump_stats(stats);
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,311 @@
+#include "parallel_critical.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <climits>
+#include "concurrent_union_find.hpp"
+#include "parallel.hpp"
+
+namespace {
+
+constexpr int kNone = -1;
+// Шаг между опорными дугами при ранжировании эйлерова обхода: каждый поток
+// проходит кусок списка от опорной дуги до следующей.
+constexpr int kSplitterStride = 256;
+// Размер блока, целиком покрываемого разреженной таблицей минимумов.
+constexpr int kRangeBlock = 64;
+
+// Минимум low и максимум high на отрезке массива: целые блоки по
+// kRangeBlock элементов — разреженной таблицей, края — перебором. Памяти
+// O(P / kRangeBlock * log P) вместо O(P log P) у таблицы по всем элементам.
+class RangeMinMax {
+public:
+    RangeMinMax(std::vector<int> low_values, std::vector<int> high_values, unsigned parts)
+        : low(std::move(low_values)), high(std::move(high_values)) {
+        int blocks = (static_cast<int>(low.size()) + kRangeBlock - 1) / kRangeBlock;
+        block_low.emplace_back(blocks);
+        block_high.emplace_back(blocks);
+        parallel_blocks(blocks, parts, [&](unsigned, size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                size_t from = b * kRangeBlock;
+                size_t to = std::min(low.size(), from + kRangeBlock);
+                block_low[0][b] = *std::min_element(low.begin() + from, low.begin() + to);
+                block_high[0][b] = *std::max_element(high.begin() + from, high.begin() + to);
+            }
+        });
+        for (int k = 1; (1 << k) <= blocks; ++k) {
+            int count = blocks - (1 << k) + 1;
+            const std::vector<int>& prev_low = block_low[k - 1];
+            const std::vector<int>& prev_high = block_high[k - 1];
+            std::vector<int> level_low(count);
+            std::vector<int> level_high(count);
+            parallel_blocks(count, parts, [&](unsigned, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    level_low[i] = std::min(prev_low[i], prev_low[i + (1 << (k - 1))]);
+                    level_high[i] = std::max(prev_high[i], prev_high[i + (1 << (k - 1))]);
+                }
+            });
+            block_low.push_back(std::move(level_low));
+            block_high.push_back(std::move(level_high));
+        }
+    }
+
+    // Отрезок [l, r] включительно.
+    std::pair<int, int> query(int l, int r) const {
+        int lo = INT_MAX;
+        int hi = INT_MIN;
+        int first_block = l / kRangeBlock;
+        int last_block = r / kRangeBlock;
+        if (first_block == last_block) {
+            scan(l, r + 1, lo, hi);
+            return {lo, hi};
+        }
+        scan(l, (first_block + 1) * kRangeBlock, lo, hi);
+        scan(last_block * kRangeBlock, r + 1, lo, hi);
+        if (first_block + 1 < last_block) {
+            int from = first_block + 1;
+            int to = last_block - 1;
+            int k = std::bit_width(static_cast<unsigned>(to - from + 1)) - 1;
+            lo = std::min({lo, block_low[k][from], block_low[k][to - (1 << k) + 1]});
+            hi = std::max({hi, block_high[k][from], block_high[k][to - (1 << k) + 1]});
+        }
+        return {lo, hi};
+    }
+
+private:
+    std::vector<int> low;
+    std::vector<int> high;
+    std::vector<std::vector<int>> block_low;
+    std::vector<std::vector<int>> block_high;
+
+    void scan(int from, int to, int& lo, int& hi) const {
+        for (int i = from; i < to; ++i) {
+            lo = std::min(lo, low[i]);
+            hi = std::max(hi, high[i]);
+        }
+    }
+};
+
+}  // namespace
+
+void find_critical_elements_parallel(const CSRGraph& graph, unsigned threads,
+                                     std::vector<int>& articulation_points,
+                                     std::vector<std::pair<int, int>>& bridges,
+                                     [[maybe_unused]] SolverStats& stats) {
+    int n = graph.vertex_count();
+    unsigned parts = std::max(1u, threads);
+    auto offsets = graph.offsets();
+    auto targets = graph.targets();
+    STATS_CLOCK(stats);
+
+    // Остовный лес: ребро, объединившее два множества, становится ребром леса.
+    // Корень компоненты — её вершина с наименьшим номером.
+    ConcurrentUnionFind components(n);
+    std::vector<std::vector<std::pair<int, int>>> part_edges(parts);
+    parallel_vertex_blocks(offsets, parts, [&](unsigned part, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            for (uint32_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+                int w = targets[i];
+                if (v < w && components.unite(v, w)) part_edges[part].push_back({v, w});
+            }
+        }
+    });
+    EdgeList tree_edges(n);
+    for (auto& list : part_edges) {
+        for (auto [u, v] : list) tree_edges.add(u, v);
+        list = {};
+    }
+    CSRGraph tree = CSRGraph::from_edges(tree_edges, false, true, parts);
+    auto tree_offsets = tree.offsets();
+    auto tree_targets = tree.targets();
+    auto tree_ids = tree.edge_ids();
+    int tree_arcs = tree.arc_count();
+    STATS_ADD(stats, "tree_edges", tree_edges.size());
+    STATS_LAP("spanning_forest");
+
+    // Эйлеров обход: после дуги u -> v идёт дуга, следующая в списке v за
+    // обратной v -> u. У корня r цикл разрывается перед первой дугой r.
+    std::vector<int> arc_of_edge(tree_arcs);
+    parallel_vertex_blocks(tree_offsets, parts, [&](unsigned, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            for (uint32_t i = tree_offsets[v]; i < tree_offsets[v + 1]; ++i) {
+                int e = tree_ids[i];
+                arc_of_edge[2 * e + (v == tree_edges.from[e] ? 0 : 1)] = i;
+            }
+        }
+    });
+    std::vector<int> twin(tree_arcs);
+    std::vector<int> succ(tree_arcs);
+    std::vector<std::vector<int>> part_roots(parts);
+    parallel_vertex_blocks(tree_offsets, parts, [&](unsigned part, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            for (uint32_t i = tree_offsets[v]; i < tree_offsets[v + 1]; ++i) {
+                int e = tree_ids[i];
+                int w = tree_targets[i];
+                twin[i] = arc_of_edge[2 * e + (v == tree_edges.from[e] ? 1 : 0)];
+                succ[i] = twin[i] + 1 < static_cast<int>(tree_offsets[w + 1]) ? twin[i] + 1 : tree_offsets[w];
+            }
+            if (components.find(v) == v) part_roots[part].push_back(v);
+        }
+    });
+    arc_of_edge = {};
+    std::vector<int> roots;
+    for (auto& list : part_roots) roots.insert(roots.end(), list.begin(), list.end());
+    for (int r : roots) {
+        if (tree.degree(r) > 0) succ[twin[tree_offsets[r + 1] - 1]] = kNone;
+    }
+    STATS_LAP("euler_tour");
+
+    // Ранжирование списка: опорные дуги — начала обходов и каждая
+    // kSplitterStride-я дуга. Куски между опорными проходятся параллельно,
+    // смещения кусков складываются последовательно по цепочке опорных.
+    std::vector<int> splitter_id(tree_arcs, kNone);
+    std::vector<int> splitters;
+    for (int r : roots) {
+        if (tree.degree(r) == 0) continue;
+        splitter_id[tree_offsets[r]] = splitters.size();
+        splitters.push_back(tree_offsets[r]);
+    }
+    for (int i = 0; i < tree_arcs; i += kSplitterStride) {
+        if (splitter_id[i] != kNone) continue;
+        splitter_id[i] = splitters.size();
+        splitters.push_back(i);
+    }
+    int splitter_count = splitters.size();
+    std::vector<int> position(tree_arcs);
+    std::vector<int> next_splitter(splitter_count);
+    std::vector<int> length(splitter_count);
+    parallel_blocks(splitter_count, parts, [&](unsigned, size_t begin, size_t end) {
+        for (size_t s = begin; s < end; ++s) {
+            int arc = splitters[s];
+            int count = 0;
+            do {
+                position[arc] = count++;
+                arc = succ[arc];
+            } while (arc != kNone && splitter_id[arc] == kNone);
+            next_splitter[s] = arc == kNone ? kNone : splitter_id[arc];
+            length[s] = count;
+        }
+    });
+
+    // Номера позиций: корень, затем дуги его обхода; компоненты подряд.
+    // Вершина v получает pre[v] — позицию дуги в неё (у корня — свою),
+    // last[v] — позицию дуги обратно; поддерево v занимает [pre[v], last[v]].
+    std::vector<int> pre(n);
+    std::vector<int> last(n);
+    std::vector<int> parent(n, kNone);
+    std::vector<int> base(splitter_count);
+    int positions = 0;
+    for (int r : roots) {
+        pre[r] = positions++;
+        if (tree.degree(r) > 0) {
+            for (int s = splitter_id[tree_offsets[r]]; s != kNone; s = next_splitter[s]) {
+                base[s] = positions;
+                positions += length[s];
+            }
+        }
+        last[r] = positions - 1;
+    }
+    parallel_blocks(splitter_count, parts, [&](unsigned, size_t begin, size_t end) {
+        for (size_t s = begin; s < end; ++s) {
+            int arc = splitters[s];
+            for (int k = 0; k < length[s]; ++k) {
+                position[arc] += base[s];
+                arc = succ[arc];
+            }
+        }
+    });
+    succ = {};
+    splitter_id = {};
+    parallel_vertex_blocks(tree_offsets, parts, [&](unsigned, int begin, int end) {
+        for (int u = begin; u < end; ++u) {
+            for (uint32_t i = tree_offsets[u]; i < tree_offsets[u + 1]; ++i) {
+                if (position[i] > position[twin[i]]) continue;
+                int w = tree_targets[i];
+                parent[w] = u;
+                pre[w] = position[i];
+                last[w] = position[twin[i]];
+            }
+        }
+    });
+    STATS_ADD(stats, "splitters", splitter_count);
+    STATS_LAP("list_ranking");
+
+    // low/high вершины — крайние pre среди неё и соседей, кроме одной копии
+    // ребра к родителю; по поддереву — минимум и максимум на его отрезке.
+    std::vector<int> low_at(positions, INT_MAX);
+    std::vector<int> high_at(positions, INT_MIN);
+    parallel_vertex_blocks(offsets, parts, [&](unsigned, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            int lo = pre[v];
+            int hi = pre[v];
+            bool skip_parent = parent[v] != kNone;
+            for (uint32_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+                int w = targets[i];
+                if (skip_parent && w == parent[v]) {
+                    skip_parent = false;
+                    continue;
+                }
+                lo = std::min(lo, pre[w]);
+                hi = std::max(hi, pre[w]);
+            }
+            low_at[pre[v]] = lo;
+            high_at[pre[v]] = hi;
+        }
+    });
+    RangeMinMax subtree(std::move(low_at), std::move(high_at), parts);
+    STATS_LAP("low_high");
+
+    // Ребро леса v — parent[v] — мост, если из поддерева v нет других рёбер
+    // наружу. Блоки — компоненты вспомогательного графа на рёбрах леса
+    // (ключ — нижняя вершина): ребро v склеивается с ребром родителя, если
+    // поддерево v выходит за поддерево родителя, а концы ребра вне леса, не
+    // лежащие на одной ветви, склеивают свои рёбра.
+    auto related = [&](int a, int b) {
+        return (pre[a] <= pre[b] && pre[b] <= last[a]) || (pre[b] <= pre[a] && pre[a] <= last[b]);
+    };
+    ConcurrentUnionFind blocks(n);
+    std::vector<std::vector<std::pair<int, int>>> part_bridges(parts);
+    parallel_vertex_blocks(offsets, parts, [&](unsigned part, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            int p = parent[v];
+            if (p != kNone) {
+                auto [lo, hi] = subtree.query(pre[v], last[v]);
+                if (lo >= pre[v] && hi <= last[v]) {
+                    part_bridges[part].push_back({std::min(v, p), std::max(v, p)});
+                }
+                if (parent[p] != kNone && (lo < pre[p] || hi > last[p])) blocks.unite(v, p);
+            }
+            for (uint32_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+                int w = targets[i];
+                if (v < w && !related(v, w)) blocks.unite(v, w);
+            }
+        }
+    });
+
+    // Точка сочленения — вершина, рёбра леса которой лежат в разных блоках:
+    // каждое ребро к ребёнку сравнивается с ребром к родителю (у корня —
+    // с ребром к первому ребёнку).
+    std::vector<std::atomic<char>> cut(n);
+    parallel_vertex_blocks(offsets, parts, [&](unsigned, int begin, int end) {
+        for (int c = begin; c < end; ++c) {
+            int p = parent[c];
+            if (p == kNone) continue;
+            int reference = parent[p] != kNone ? p : tree_targets[tree_offsets[p]];
+            if (blocks.find(c) != blocks.find(reference)) cut[p].store(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<std::vector<int>> part_points(parts);
+    parallel_vertex_blocks(offsets, parts, [&](unsigned part, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            if (cut[v].load(std::memory_order_relaxed)) part_points[part].push_back(v);
+        }
+    });
+    articulation_points.clear();
+    for (auto& list : part_points) articulation_points.insert(articulation_points.end(), list.begin(), list.end());
+    bridges.clear();
+    for (auto& list : part_bridges) bridges.insert(bridges.end(), list.begin(), list.end());
+    std::sort(bridges.begin(), bridges.end());
+    STATS_LAP("classify");
+}
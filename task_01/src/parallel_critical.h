@@ -0,0 +1,18 @@
+#ifndef PARALLEL_CRITICAL_H
+#define PARALLEL_CRITICAL_H
+
+#include <utility>
+#include <vector>
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
+
+// Точки сочленения и мосты в стиле Тарьяна–Вишкина: вместо обхода в глубину
+// — произвольный остовный лес (параллельная система множеств), эйлеров обход
+// с параллельным ранжированием списка, минимумы и максимумы номеров по
+// поддеревьям и классификация рёбер леса. Все шаги идут на threads потоках;
+// результат отсортирован и совпадает с последовательным Тарьяном.
+void find_critical_elements_parallel(const CSRGraph& graph, unsigned threads,
+                                     std::vector<int>& articulation_points,
+                                     std::vector<std::pair<int, int>>& bridges, SolverStats& stats);
+
+#endif
@@ -0,0 +1,136 @@
+#include "streaming_critical.h"
+#include <algorithm>
+#include "csr_graph.hpp"
+#include "dfs.hpp"
+
+StreamingCritical::StreamingCritical(int vertices) : n(vertices), sets(vertices) {
+}
+
+void StreamingCritical::edge(int u, int v) {
+    ++edge_count;
+    if (u == v) return;
+    switch (current_pass) {
+        case 0:
+            if (!sets.same(u, v)) {
+                sets.unite(u, v);
+                tree_from.push_back(u);
+                tree_to.push_back(v);
+            }
+            break;
+        case 1:
+            // ребро леса и все его копии
+            if (parent[u] == v || parent[v] == u) break;
+            low[u] = std::min(low[u], pre[v]);
+            high[u] = std::max(high[u], pre[v]);
+            low[v] = std::min(low[v], pre[u]);
+            high[v] = std::max(high[v], pre[u]);
+            break;
+        case 2:
+            if (!related(u, v)) sets.unite(u, v);
+            break;
+        default:
+            break;
+    }
+}
+
+void StreamingCritical::finish_pass() {
+    STATS_ADD(stats, "edges_streamed", edge_count);
+    switch (current_pass) {
+        case 0:
+            root_forest();
+            break;
+        case 1:
+            classify_tree_edges();
+            break;
+        case 2:
+            collect_articulation_points();
+            break;
+        default:
+            return;
+    }
+    edge_count = 0;
+    current_pass = current_pass + 1 < kPasses ? current_pass + 1 : -1;
+}
+
+void StreamingCritical::root_forest() {
+    STATS_PHASE(stats, "root_forest");
+    EdgeList tree_edges(n);
+    tree_edges.from = std::move(tree_from);
+    tree_edges.to = std::move(tree_to);
+    CSRGraph tree = CSRGraph::from_edges(tree_edges, false);
+    tree_edges = EdgeList();
+    STATS_ADD(stats, "tree_edges", tree.arc_count() / 2);
+
+    parent.assign(n, -1);
+    pre.assign(n, -1);
+    last.assign(n, -1);
+
+    struct Visitor : DfsVisitor {
+        StreamingCritical& solver;
+        int timer = 0;
+
+        explicit Visitor(StreamingCritical& solver) : solver(solver) {}
+
+        void enter(int v, int p) {
+            solver.parent[v] = p;
+            solver.pre[v] = timer++;
+        }
+
+        void leave(int v, int) { solver.last[v] = timer - 1; }
+    };
+
+    Visitor visitor(*this);
+    DfsEngine dfs(n);
+    for (int v = 0; v < n; ++v) {
+        if (!dfs.visited(v)) dfs.run(tree, v, visitor);
+    }
+    low = pre;
+    high = pre;
+    sets.reset(n);
+}
+
+void StreamingCritical::classify_tree_edges() {
+    STATS_PHASE(stats, "classify_tree_edges");
+    // снизу вверх: к моменту v всё его поддерево уже собрано в low/high[v]
+    std::vector<int> order(n);
+    for (int v = 0; v < n; ++v) {
+        order[pre[v]] = v;
+    }
+    bridges.clear();
+    for (int i = n - 1; i >= 0; --i) {
+        int v = order[i];
+        int p = parent[v];
+        if (p == -1) continue;
+        if (low[v] >= pre[v] && high[v] <= last[v]) {
+            bridges.push_back({std::min(v, p), std::max(v, p)});
+        }
+        if (parent[p] != -1 && (low[v] < pre[p] || high[v] > last[p])) sets.unite(v, p);
+        low[p] = std::min(low[p], low[v]);
+        high[p] = std::max(high[p], high[v]);
+    }
+    std::sort(bridges.begin(), bridges.end());
+    low = {};
+    high = {};
+}
+
+void StreamingCritical::collect_articulation_points() {
+    STATS_PHASE(stats, "collect_articulation_points");
+    // ребро к ребёнку сравнивается с ребром к родителю, у корня — с ребром
+    // к первому ребёнку
+    std::vector<int> first_child(n, -1);
+    for (int v = 0; v < n; ++v) {
+        int p = parent[v];
+        if (p != -1 && parent[p] == -1 && first_child[p] == -1) first_child[p] = v;
+    }
+    std::vector<char> cut(n, 0);
+    for (int c = 0; c < n; ++c) {
+        int p = parent[c];
+        if (p == -1) continue;
+        int reference = parent[p] != -1 ? p : first_child[p];
+        if (!sets.same(c, reference)) cut[p] = 1;
+    }
+    articulation_points.clear();
+    for (int v = 0; v < n; ++v) {
+        if (cut[v]) articulation_points.push_back(v);
+    }
+}
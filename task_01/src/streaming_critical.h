@@ -0,0 +1,70 @@
+#ifndef STREAMING_CRITICAL_H
+#define STREAMING_CRITICAL_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "solver_stats.hpp"
+#include "union_find.hpp"
+
+// Мосты и точки сочленения для списков рёбер, которые не помещаются в память:
+// рёбра читаются несколькими проходами, а в памяти лежит только O(n).
+//   0: остовный лес системой множеств;
+//   1: low/high каждой вершины по рёбрам вне леса, затем по поддеревьям —
+//      отсюда мосты и склейка соседних рёбер леса в блоки;
+//   2: рёбра вне леса между разными ветвями склеивают блоки (Тарьян–Вишкин),
+//      после чего известны точки сочленения.
+// Кратные рёбра считаются одним, как после normalize_undirected в драйвере.
+// Каждый проход должен подавать те же рёбра в том же порядке:
+//
+//     StreamingCritical solver(n);
+//     while (solver.pass() != -1) {
+//         for (каждое ребро u v) solver.edge(u, v);
+//         solver.finish_pass();
+//     }
+class StreamingCritical {
+public:
+    explicit StreamingCritical(int vertices);
+
+    // Номер текущего прохода или -1, если ответ готов.
+    int pass() const { return current_pass; }
+    void edge(int u, int v);
+    void finish_pass();
+
+    // Отсортированы так же, как у Graph; доступны после последнего прохода.
+    std::vector<int> get_articulation_points() const { return articulation_points; }
+    std::vector<std::pair<int, int>> get_bridges() const { return bridges; }
+    SolverStats get_stats() const { return stats; }
+
+    static constexpr int kPasses = 3;
+
+private:
+    int n;
+    int current_pass = 0;
+    uint64_t edge_count = 0;
+    // на проходе 0 — компоненты, дальше — блоки рёбер леса (ключ — нижняя вершина)
+    UnionFind sets;
+
+    // лес, подвешенный обходом в глубину: поддерево v — pre в [pre[v], last[v]]
+    std::vector<int> parent;
+    std::vector<int> pre;
+    std::vector<int> last;
+    std::vector<int> low;
+    std::vector<int> high;
+    // концы рёбер леса; после подвешивания не нужны
+    std::vector<int> tree_from;
+    std::vector<int> tree_to;
+
+    std::vector<int> articulation_points;
+    std::vector<std::pair<int, int>> bridges;
+    SolverStats stats{"streaming_critical"};
+
+    bool related(int a, int b) const {
+        return (pre[a] <= pre[b] && pre[b] <= last[a]) || (pre[b] <= pre[a] && pre[a] <= last[b]);
+    }
+    void root_forest();
+    void classify_tree_edges();
+    void collect_articulation_points();
+};
+
+#endif
@@ -2,7 +2,20 @@
 #include <cassert>
 #include <vector>
 #include <algorithm>
+#include <set>
+#include <limits>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include "edge_normalize.hpp"
+#include "fast_reader.hpp"
+#include "failure_batch.h"
+#include "failure_index.h"
 #include "graph.h"
+#include "graph_generators.hpp"
+#include "incremental_bridges.h"
+#include "parallel_critical.h"
+#include "streaming_critical.h"
 
 void test_single_edge() {
     Graph g(2);
@@ -163,10 +176,10 @@ void test_parallel_edges() {
     std::vector<int> articulation_points = g.get_articulation_points();
     std::vector<std::pair<int, int>> bridges = g.get_bridges();
     
+    // двойной кабель 0-1 не мост, 1-2-3 — цикл
     assert(articulation_points.size() == 1);
     assert(articulation_points[0] == 1);
-    assert(bridges.size() == 1);
-    assert(bridges[0] == std::make_pair(1, 2));
+    assert(bridges.empty());
     
     std::cout << "test_parallel_edges: OK" << std::endl;
 }
@@ -204,6 +217,519 @@ void test_empty_graph() {
     std::cout << "test_empty_graph: OK" << std::endl;
 }
 
+void test_from_csr() {
+    EdgeList edges(4);
+    edges.add(0, 1);
+    edges.add(1, 2);
+    edges.add(2, 0);
+    edges.add(2, 3);
+    Graph g(CSRGraph::from_edges(edges, false));
+    g.find_critical_elements();
+    
+    assert(g.get_articulation_points() == std::vector<int>({2}));
+    std::vector<std::pair<int, int>> expected_bridges = {{2, 3}};
+    assert(g.get_bridges() == expected_bridges);
+    
+    g.add_edge(3, 0);
+    g.find_critical_elements();
+    assert(g.get_articulation_points().empty());
+    assert(g.get_bridges().empty());
+    
+    // обратно в список: ребро один раз с u < v, кратные рёбра и петли остаются
+    EdgeList weighted(4);
+    int pairs[][2] = {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {1, 0}, {3, 3}};
+    for (int i = 0; i < 6; ++i) weighted.add(pairs[i][0], pairs[i][1], 10 + i);
+    EdgeList back = CSRGraph::from_edges(weighted, false).to_edge_list();
+    assert(back.from == std::vector<int>({0, 0, 0, 1, 2, 3}));
+    assert(back.to == std::vector<int>({1, 2, 1, 2, 3, 3}));
+    assert(back.weights == std::vector<long long>({10, 12, 14, 11, 13, 15}));
+    assert(CSRGraph::from_edges(weighted, true).to_edge_list().size() == 6);
+    
+    std::cout << "test_from_csr: OK" << std::endl;
+}
+
+void test_normalize_edges() {
+    EdgeList edges = random_graph(3000, 20000, 7);
+    for (int i = 0; i < 500; ++i) {
+        edges.add(edges.to[i], edges.from[i]);
+        edges.add(i, i);
+    }
+    
+    std::set<std::pair<int, int>> expected;
+    for (int i = 0; i < edges.size(); ++i) {
+        int u = edges.from[i];
+        int v = edges.to[i];
+        if (u != v) expected.insert({std::min(u, v), std::max(u, v)});
+    }
+    
+    normalize_undirected(edges);
+    assert(edges.size() == static_cast<int>(expected.size()));
+    int i = 0;
+    for (auto [u, v] : expected) {
+        assert(edges.from[i] == u && edges.to[i] == v);
+        ++i;
+    }
+    
+    EdgeList loops(1);
+    loops.add(0, 0);
+    normalize_undirected(loops);
+    assert(loops.empty());
+    
+    std::cout << "test_normalize_edges: OK" << std::endl;
+}
+
+void test_failure_index_blocks() {
+    // два треугольника, соединённые мостом 2-3, и висячая вершина 6
+    Graph g(8);
+    g.add_edge(0, 1);
+    g.add_edge(1, 2);
+    g.add_edge(2, 0);
+    g.add_edge(2, 3);
+    g.add_edge(3, 4);
+    g.add_edge(4, 5);
+    g.add_edge(5, 3);
+    g.add_edge(5, 6);
+    FailureIndex index = g.build_failure_index();
+    
+    assert(index.block_count() == 5);
+    assert(index.two_edge_component_count() == 4);
+    assert(index.two_edge_component(0) == index.two_edge_component(2));
+    assert(index.two_edge_component(2) != index.two_edge_component(3));
+    assert(index.two_edge_component(6) != index.two_edge_component(5));
+    assert(index.is_articulation_point(2) && index.is_articulation_point(3) && index.is_articulation_point(5));
+    assert(!index.is_articulation_point(0) && !index.is_articulation_point(7));
+    assert(index.is_bridge(3, 2) && index.is_bridge(5, 6) && !index.is_bridge(3, 4));
+    
+    assert(!index.connected(0, 7));
+    assert(index.connected_without_vertex(0, 1, 2));
+    assert(!index.connected_without_vertex(0, 4, 2));
+    assert(!index.connected_without_vertex(0, 4, 3));
+    assert(index.connected_without_vertex(3, 6, 4));
+    assert(!index.connected_without_vertex(4, 6, 5));
+    assert(index.connected_without_edge(0, 4, 3, 4));
+    assert(!index.connected_without_edge(1, 5, 3, 2));
+    assert(index.connected_without_edge(3, 5, 2, 3));
+    
+    std::cout << "test_failure_index_blocks: OK" << std::endl;
+}
+
+void test_failure_index_parallel_edges() {
+    // ребро 0-1 проложено двумя кабелями: обрыв одного не разрывает сеть
+    EdgeList edges(3);
+    edges.add(0, 1);
+    edges.add(1, 0);
+    edges.add(1, 2);
+    FailureIndex index(CSRGraph::from_edges(edges, false));
+    
+    assert(!index.is_bridge(0, 1));
+    assert(index.is_bridge(1, 2));
+    assert(index.connected_without_edge(0, 2, 0, 1));
+    assert(!index.connected_without_edge(0, 2, 1, 2));
+    assert(index.two_edge_component(0) == index.two_edge_component(1));
+    assert(index.block_count() == 2);
+    
+    std::cout << "test_failure_index_parallel_edges: OK" << std::endl;
+}
+
+// Связность a и b после удаления вершины skip_vertex или ребра с номером
+// skip_edge — обходом в ширину по списку рёбер.
+static bool brute_connected(const EdgeList& edges, int a, int b, int skip_vertex, int skip_edge) {
+    std::vector<std::vector<int>> adj(edges.n);
+    for (int i = 0; i < edges.size(); ++i) {
+        if (i == skip_edge) continue;
+        int u = edges.from[i];
+        int v = edges.to[i];
+        if (u == skip_vertex || v == skip_vertex) continue;
+        adj[u].push_back(v);
+        adj[v].push_back(u);
+    }
+    std::vector<char> seen(edges.n, 0);
+    std::vector<int> queue = {a};
+    seen[a] = 1;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (int to : adj[queue[head]]) {
+            if (!seen[to]) {
+                seen[to] = 1;
+                queue.push_back(to);
+            }
+        }
+    }
+    return seen[b];
+}
+
+void test_failure_index_random() {
+    for (int seed = 1; seed <= 30; ++seed) {
+        int n = 6 + seed % 10;
+        EdgeList edges = random_graph(n, n + seed % 7, seed);
+        FailureIndex index(CSRGraph::from_edges(edges, false));
+        
+        for (int a = 0; a < n; ++a) {
+            for (int b = 0; b < n; ++b) {
+                assert(index.connected(a, b) == brute_connected(edges, a, b, -1, -1));
+                for (int x = 0; x < n; ++x) {
+                    if (x == a || x == b) continue;
+                    assert(index.connected_without_vertex(a, b, x) == brute_connected(edges, a, b, x, -1));
+                }
+                for (int e = 0; e < edges.size(); ++e) {
+                    bool expected = brute_connected(edges, a, b, -1, e);
+                    assert(index.connected_without_edge(a, b, edges.from[e], edges.to[e]) == expected);
+                }
+            }
+        }
+        
+        Graph g(CSRGraph::from_edges(edges, false));
+        g.find_critical_elements();
+        std::vector<int> articulation_points = g.get_articulation_points();
+        for (int v = 0; v < n; ++v) {
+            bool expected = std::binary_search(articulation_points.begin(), articulation_points.end(), v);
+            assert(index.is_articulation_point(v) == expected);
+        }
+    }
+    
+    std::cout << "test_failure_index_random: OK" << std::endl;
+}
+
+void test_incremental_bridges() {
+    EdgeList edges = random_graph(60, 90, 11);
+    normalize_undirected(edges);
+    
+    Graph incremental(edges.n);
+    incremental.track_incrementally();
+    for (int i = 0; i < edges.size(); ++i) {
+        incremental.add_edge(edges.from[i], edges.to[i]);
+        
+        Graph full(edges.n);
+        for (int j = 0; j <= i; ++j) {
+            full.add_edge(edges.from[j], edges.to[j]);
+        }
+        full.find_critical_elements();
+        assert(incremental.get_articulation_points() == full.get_articulation_points());
+        assert(incremental.get_bridges() == full.get_bridges());
+    }
+    
+    std::cout << "test_incremental_bridges: OK" << std::endl;
+}
+
+void test_incremental_two_edge_components() {
+    IncrementalBridges tracker(6);
+    tracker.add_edge(0, 1);
+    tracker.add_edge(1, 2);
+    tracker.add_edge(3, 4);
+    tracker.add_edge(2, 3);
+    assert(tracker.bridge_count() == 4);
+    assert(tracker.articulation_points() == std::vector<int>({1, 2, 3}));
+    
+    // второй кабель 2-3 убирает мост, но не точки сочленения
+    tracker.add_edge(3, 2);
+    assert(tracker.bridge_count() == 3);
+    assert(tracker.two_edge_component(2) == tracker.two_edge_component(3));
+    assert(tracker.articulation_points() == std::vector<int>({1, 2, 3}));
+    
+    tracker.add_edge(4, 0);
+    assert(tracker.bridge_count() == 0);
+    assert(tracker.articulation_points().empty());
+    assert(tracker.two_edge_component(0) == tracker.two_edge_component(4));
+    assert(!tracker.connected(0, 5));
+    
+    // граф, собранный из CSR, переводится в инкрементальный режим
+    EdgeList chain = chain_graph(5);
+    Graph g(CSRGraph::from_edges(chain, false));
+    g.track_incrementally();
+    assert(g.get_bridges().size() == 4);
+    g.add_edge(4, 0);
+    assert(g.get_bridges().empty());
+    assert(g.get_articulation_points().empty());
+    
+    std::cout << "test_incremental_two_edge_components: OK" << std::endl;
+}
+
+void test_parallel_matches_sequential() {
+    std::vector<EdgeList> inputs = {
+        random_graph(2000, 2600, 3),
+        random_graph(3000, 9000, 5),
+        grid_graph(40, 50),
+        chain_graph(5000),
+        random_tree(4000, 9),
+        caterpillar_tree(3000, 100, 4),
+        EdgeList(10),
+    };
+    for (EdgeList& edges : inputs) {
+        normalize_undirected(edges);
+        CSRGraph graph = CSRGraph::from_edges(edges, false);
+        Graph g(graph);
+        g.find_critical_elements();
+        
+        for (unsigned threads : {1u, 3u, 8u}) {
+            std::vector<int> articulation_points;
+            std::vector<std::pair<int, int>> bridges;
+            SolverStats stats;
+            find_critical_elements_parallel(graph, threads, articulation_points, bridges, stats);
+            assert(articulation_points == g.get_articulation_points());
+            assert(bridges == g.get_bridges());
+        }
+    }
+    
+    std::cout << "test_parallel_matches_sequential: OK" << std::endl;
+}
+
+void test_parallel_parallel_edges() {
+    // двойной кабель 0-1 не мост, точка сочленения 1 остаётся
+    EdgeList edges(4);
+    edges.add(0, 1);
+    edges.add(1, 0);
+    edges.add(1, 2);
+    edges.add(2, 3);
+    std::vector<int> articulation_points;
+    std::vector<std::pair<int, int>> bridges;
+    SolverStats stats;
+    find_critical_elements_parallel(CSRGraph::from_edges(edges, false), 4, articulation_points, bridges, stats);
+    
+    assert(articulation_points == std::vector<int>({1, 2}));
+    std::vector<std::pair<int, int>> expected_bridges = {{1, 2}, {2, 3}};
+    assert(bridges == expected_bridges);
+    
+    std::cout << "test_parallel_parallel_edges: OK" << std::endl;
+}
+
+void test_engines_agree_on_multigraph() {
+    // дерево с удвоенной половиной рёбер: граф выше порога, с которого
+    // find_critical_elements_parallel не откатывается к Тарьяну
+    const int n = 200000;
+    EdgeList tree = random_tree(n, 23);
+    EdgeList edges(n);
+    for (int i = 0; i < tree.size(); ++i) {
+        edges.add(tree.from[i], tree.to[i]);
+        if (i % 2 == 0) edges.add(tree.to[i], tree.from[i]);
+    }
+    CSRGraph graph = CSRGraph::from_edges(edges, false);
+    assert(graph.arc_count() / (1 << 17) >= 2);
+    
+    Graph sequential(graph);
+    sequential.find_critical_elements();
+    assert(static_cast<int>(sequential.get_bridges().size()) == tree.size() / 2);
+    
+    Graph parallel(graph);
+    parallel.find_critical_elements_parallel(4);
+    assert(parallel.get_bridges() == sequential.get_bridges());
+    assert(parallel.get_articulation_points() == sequential.get_articulation_points());
+    
+    Graph by_component(graph);
+    by_component.find_critical_elements_by_component(4);
+    assert(by_component.get_bridges() == sequential.get_bridges());
+    assert(by_component.get_articulation_points() == sequential.get_articulation_points());
+    
+    FailureIndex index(graph);
+    std::vector<int> articulation_points = sequential.get_articulation_points();
+    for (int v = 0; v < n; v += 997) {
+        bool expected = std::binary_search(articulation_points.begin(), articulation_points.end(), v);
+        assert(index.is_articulation_point(v) == expected);
+    }
+    
+    std::cout << "test_engines_agree_on_multigraph: OK" << std::endl;
+}
+
+void test_by_component_matches_sequential() {
+    // много мелких компонент и одна крупная
+    EdgeList edges(0);
+    int offset = 0;
+    auto append = [&](const EdgeList& part) {
+        for (int i = 0; i < part.size(); ++i) {
+            edges.add(part.from[i] + offset, part.to[i] + offset);
+        }
+        offset += part.n;
+        edges.n = offset;
+    };
+    append(random_graph(3000, 4000, 1));
+    for (int k = 0; k < 300; ++k) {
+        append(random_graph(5 + k % 20, 6 + k % 25, k));
+        append(EdgeList(1));
+    }
+    normalize_undirected(edges);
+    CSRGraph graph = CSRGraph::from_edges(edges, false);
+    Graph expected(graph);
+    expected.find_critical_elements();
+    
+    for (unsigned threads : {1u, 4u}) {
+        Graph g(graph);
+        g.find_critical_elements_by_component(threads);
+        assert(g.get_articulation_points() == expected.get_articulation_points());
+        assert(g.get_bridges() == expected.get_bridges());
+    }
+    
+    std::cout << "test_by_component_matches_sequential: OK" << std::endl;
+}
+
+void test_streaming_matches_in_memory() {
+    std::vector<EdgeList> inputs = {
+        random_graph(2000, 2600, 13),
+        random_graph(500, 3000, 17),
+        grid_graph(30, 30),
+        chain_graph(3000),
+        random_tree(2000, 21),
+    };
+    for (EdgeList& edges : inputs) {
+        // кратные рёбра и петли во входе потока
+        for (int i = 0; i < 200 && i < edges.size(); ++i) {
+            edges.add(edges.to[i], edges.from[i]);
+            edges.add(i, i);
+        }
+        
+        StreamingCritical solver(edges.n);
+        int passes = 0;
+        while (solver.pass() != -1) {
+            for (int i = 0; i < edges.size(); ++i) {
+                solver.edge(edges.from[i], edges.to[i]);
+            }
+            solver.finish_pass();
+            ++passes;
+        }
+        assert(passes == StreamingCritical::kPasses);
+        
+        normalize_undirected(edges);
+        Graph g(CSRGraph::from_edges(edges, false));
+        g.find_critical_elements();
+        assert(solver.get_articulation_points() == g.get_articulation_points());
+        assert(solver.get_bridges() == g.get_bridges());
+    }
+    
+    std::cout << "test_streaming_matches_in_memory: OK" << std::endl;
+}
+
+void test_reader_rejects_malformed() {
+    // FastReader читает и stdin, и файл потока рёбер (--stream)
+    std::string path = (std::filesystem::temp_directory_path() / "task_01_reader_test.in").string();
+    std::ofstream(path) << "3 x5 - 5\n-7 abc 12abc 8\n"
+                           "9223372036854775807 -9223372036854775808 9223372036854775808 "
+                           "123456789012345678901234567890 -4";
+    FastReader in(path.c_str());
+    std::filesystem::remove(path);
+    
+    auto rejects = [&] {
+        try {
+            in.read_long();
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    // плохой токен пропускается, чтение продолжается со следующего
+    assert(in.read_long() == 3);
+    assert(rejects());
+    assert(rejects());
+    assert(in.read_long() == 5);
+    assert(in.read_long() == -7);
+    assert(rejects());
+    assert(rejects());
+    assert(in.read_long() == 8);
+    // границы long long и переполнение
+    assert(in.read_long() == std::numeric_limits<long long>::max());
+    assert(in.read_long() == std::numeric_limits<long long>::min());
+    assert(rejects());
+    assert(rejects());
+    assert(in.read_long() == -4);
+    assert(in.at_end());
+    
+    std::cout << "test_reader_rejects_malformed: OK" << std::endl;
+}
+
+// Компоненты после отказа вершин и рёбер (каждое ребро снимается один раз)
+// обходом в ширину.
+static FailureImpact brute_impact(const EdgeList& edges, const FailureSet& failure) {
+    std::vector<char> failed(edges.n, 0);
+    for (int v : failure.vertices) failed[v] = 1;
+    std::vector<char> removed(edges.size(), 0);
+    for (auto [u, v] : failure.edges) {
+        for (int i = 0; i < edges.size(); ++i) {
+            bool same = (edges.from[i] == u && edges.to[i] == v) || (edges.from[i] == v && edges.to[i] == u);
+            if (same && !removed[i]) {
+                removed[i] = 1;
+                break;
+            }
+        }
+    }
+    auto count = [&](bool with_failures) {
+        std::vector<std::vector<int>> adj(edges.n);
+        for (int i = 0; i < edges.size(); ++i) {
+            int u = edges.from[i];
+            int v = edges.to[i];
+            if (with_failures && (removed[i] || failed[u] || failed[v])) continue;
+            adj[u].push_back(v);
+            adj[v].push_back(u);
+        }
+        std::vector<int> label(edges.n, -1);
+        int components = 0;
+        for (int s = 0; s < edges.n; ++s) {
+            if (label[s] != -1 || (with_failures && failed[s])) continue;
+            std::vector<int> queue = {s};
+            label[s] = s;
+            for (size_t head = 0; head < queue.size(); ++head) {
+                for (int to : adj[queue[head]]) {
+                    if (label[to] == -1) {
+                        label[to] = s;
+                        queue.push_back(to);
+                    }
+                }
+            }
+            components++;
+        }
+        return std::make_pair(components, label);
+    };
+    std::vector<int> old_label = count(false).second;
+    auto [after, new_label] = count(true);
+    // компонента распалась, если её уцелевшие вершины получили разные метки
+    std::vector<int> seen(edges.n, -1);
+    bool disconnects = false;
+    for (int v = 0; v < edges.n; ++v) {
+        if (failed[v]) continue;
+        int& first = seen[old_label[v]];
+        if (first == -1) first = new_label[v];
+        if (first != new_label[v]) disconnects = true;
+    }
+    return {after, disconnects};
+}
+
+void test_failure_batch_random() {
+    for (int seed = 1; seed <= 40; ++seed) {
+        int n = 6 + seed % 12;
+        EdgeList edges = random_graph(n, n + seed % 9, seed);
+        // кратные рёбра
+        for (int i = 0; i < 3 && i < edges.size(); ++i) {
+            edges.add(edges.from[i * 2 % edges.size()], edges.to[i * 2 % edges.size()]);
+        }
+        Graph g(CSRGraph::from_edges(edges, false));
+        
+        std::vector<FailureSet> scenarios;
+        unsigned state = seed;
+        auto next = [&](int bound) {
+            state = state * 1103515245u + 12345u;
+            return static_cast<int>((state >> 8) % bound);
+        };
+        for (int i = 0; i < 300; ++i) {
+            FailureSet failure;
+            int size = 1 + next(3);
+            int kind = next(3);
+            for (int j = 0; j < size; ++j) {
+                if (kind == 0 || (kind == 2 && next(2) == 0)) {
+                    failure.vertices.push_back(next(n));
+                } else {
+                    int e = next(edges.size());
+                    failure.edges.push_back({edges.from[e], edges.to[e]});
+                }
+            }
+            scenarios.push_back(failure);
+        }
+        std::vector<FailureImpact> impact = g.analyze_failures(scenarios);
+        assert(impact.size() == scenarios.size());
+        for (size_t i = 0; i < scenarios.size(); ++i) {
+            FailureImpact expected = brute_impact(edges, scenarios[i]);
+            assert(impact[i].components == expected.components);
+            assert(impact[i].disconnects == expected.disconnects);
+        }
+    }
+    
+    std::cout << "test_failure_batch_random: OK" << std::endl;
+}
+
 int main() {
     test_single_edge();
     test_triangle();
@@ -215,6 +741,20 @@ int main() {
     test_parallel_edges();
     test_self_loops();
     test_empty_graph();
+    test_from_csr();
+    test_normalize_edges();
+    test_failure_index_blocks();
+    test_failure_index_parallel_edges();
+    test_failure_index_random();
+    test_incremental_bridges();
+    test_incremental_two_edge_components();
+    test_parallel_matches_sequential();
+    test_parallel_parallel_edges();
+    test_engines_agree_on_multigraph();
+    test_by_component_matches_sequential();
+    test_streaming_matches_in_memory();
+    test_reader_rejects_malformed();
+    test_failure_batch_random();
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include <benchmark/benchmark.h>
+#include "bench_alloc.hpp"
+#include "condensation.h"
+#include "dfs.hpp"
+#include "graph.h"
+#include "graph_generators.hpp"
+#include "reachability.h"
+#include "scc.h"
+
+enum Family { kRandom, kDag, kCycle };
+
+static const char* family_name(int family) {
+    static const char* names[] = {"random", "dag", "cycle"};
+    return names[family];
+}
+
+static EdgeList make_graph(int family, int n) {
+    switch (family) {
+        case kRandom:
+            return random_graph(n, 2LL * n, 42);
+        case kDag:
+            return random_dag(n, 2LL * n, 42);
+        default: {
+            EdgeList edges = chain_graph(n);
+            edges.add(n - 1, 0);
+            return edges;
+        }
+    }
+}
+
+static void BM_MinEdgesToMakeStronglyConnected(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    Graph g(CSRGraph::from_edges(edges, true));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(g.min_edges_to_make_strongly_connected());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Один проход Тарьяна–Пирса против прежнего Косарайю с транспонированием.
+static void BM_StronglyConnectedComponents(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    CSRGraph graph = CSRGraph::from_edges(edges, true);
+    std::vector<int> comp_id(edges.n);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(strongly_connected_components(graph, comp_id));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_StronglyConnectedComponentsKosaraju(benchmark::State& state) {
+    struct OrderVisitor : DfsVisitor {
+        std::vector<int> order;
+        void leave(int v, int) { order.push_back(v); }
+    };
+    struct ComponentVisitor : DfsVisitor {
+        std::vector<int>& comp_id;
+        int current = 0;
+        explicit ComponentVisitor(std::vector<int>& comp_id) : comp_id(comp_id) {}
+        void enter(int v, int) { comp_id[v] = current; }
+    };
+
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    CSRGraph graph = CSRGraph::from_edges(edges, true);
+    std::vector<int> comp_id(edges.n);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            CSRGraph reverse = graph.transpose();
+            OrderVisitor order_visitor;
+            DfsEngine dfs(edges.n);
+            for (int v = 0; v < edges.n; ++v) {
+                if (!dfs.visited(v)) dfs.run(graph, v, order_visitor);
+            }
+            ComponentVisitor component_visitor(comp_id);
+            dfs.reset(edges.n);
+            for (int i = edges.n - 1; i >= 0; --i) {
+                int v = order_visitor.order[i];
+                if (dfs.visited(v)) continue;
+                dfs.run(reverse, v, component_visitor);
+                component_visitor.current++;
+            }
+            benchmark::DoNotOptimize(component_visitor.current);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Конденсация с поразрядной очисткой дуг и список дуг Эсварана–Тарьяна.
+static void BM_CondensationAugmentation(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    CSRGraph graph = CSRGraph::from_edges(edges, true);
+    std::vector<int> comp_id(edges.n);
+    int comp_count = strongly_connected_components(graph, comp_id);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            Condensation condensation(graph, comp_id, comp_count);
+            benchmark::DoNotOptimize(condensation.augmentation().size());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Ответ после каждой из пачек дуг: IncrementalSCC против полного пересчёта.
+static void BM_IncrementalInsert(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            Graph g(edges.n);
+            g.track_incrementally();
+            for (int i = 0; i < edges.size(); ++i) {
+                g.add_edge(edges.from[i], edges.to[i]);
+                if (i % 64 == 0) benchmark::DoNotOptimize(g.min_edges_to_make_strongly_connected());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * edges.size());
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_RecomputePerBatch(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            Graph g(edges.n);
+            for (int i = 0; i < edges.size(); ++i) {
+                g.add_edge(edges.from[i], edges.to[i]);
+                if (i % 64 == 0) benchmark::DoNotOptimize(g.min_edges_to_make_strongly_connected());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * edges.size());
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// Пакет из 2^16 запросов достижимости: битовые строки (режим 0) против
+// 2-hop меток (режим 1).
+static void BM_ReachabilityQueries(benchmark::State& state) {
+    EdgeList edges = make_graph(kDag, state.range(0));
+    CSRGraph graph = CSRGraph::from_edges(edges, true);
+    std::vector<int> comp_id(edges.n);
+    int comp_count = strongly_connected_components(graph, comp_id);
+    Condensation condensation(graph, comp_id, comp_count);
+    size_t budget = state.range(1) == 0 ? ReachabilityIndex::kDefaultBitsetBytes : 0;
+    ReachabilityIndex index(condensation, budget);
+    EdgeList queries = random_graph(edges.n, 1 << 16, 7);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.reachable(queries));
+    }
+    state.SetItemsProcessed(state.iterations() * queries.size());
+    state.SetLabel(state.range(1) == 0 ? "bitsets" : "labels");
+}
+
+static void BM_BuildReachabilityIndex(benchmark::State& state) {
+    EdgeList edges = make_graph(kDag, state.range(0));
+    CSRGraph graph = CSRGraph::from_edges(edges, true);
+    std::vector<int> comp_id(edges.n);
+    int comp_count = strongly_connected_components(graph, comp_id);
+    Condensation condensation(graph, comp_id, comp_count);
+    size_t budget = state.range(1) == 0 ? ReachabilityIndex::kDefaultBitsetBytes : 0;
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            ReachabilityIndex index(condensation, budget);
+            benchmark::DoNotOptimize(index.reachable(0, edges.n - 1));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(state.range(1) == 0 ? "bitsets" : "labels");
+}
+
+BENCHMARK(BM_MinEdgesToMakeStronglyConnected)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kDag, kCycle}});
+
+BENCHMARK(BM_CondensationAugmentation)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kDag, kCycle}});
+
+BENCHMARK(BM_IncrementalInsert)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kDag, kCycle}});
+BENCHMARK(BM_RecomputePerBatch)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 12, 4), {kRandom, kDag, kCycle}});
+
+BENCHMARK(BM_ReachabilityQueries)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {0, 1}});
+BENCHMARK(BM_BuildReachabilityIndex)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {0, 1}});
+
+BENCHMARK(BM_StronglyConnectedComponents)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kDag, kCycle}});
+BENCHMARK(BM_StronglyConnectedComponentsKosaraju)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kDag, kCycle}});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+#include "condensation.h"
+#include <algorithm>
+#include "dfs.hpp"
+#include "edge_normalize.hpp"
+
+Condensation::Condensation(const CSRGraph& graph, std::vector<int> comp_id, int comp_count)
+    : comp_id(std::move(comp_id)), representatives(comp_count, -1), in_degrees(comp_count, 0) {
+    int n = graph.vertex_count();
+    for (int v = 0; v < n; ++v) {
+        int& r = representatives[this->comp_id[v]];
+        if (r == -1) r = v;
+    }
+
+    EdgeList arcs(comp_count);
+    for (int v = 0; v < n; ++v) {
+        int c = this->comp_id[v];
+        for (int u : graph.neighbors(v)) {
+            if (c != this->comp_id[u]) arcs.add(c, this->comp_id[u]);
+        }
+    }
+    normalize_directed(arcs);
+    for (int d : arcs.to) {
+        in_degrees[d]++;
+    }
+    dag_graph = CSRGraph::from_edges(arcs, true);
+
+    for (int c = 0; c < comp_count; ++c) {
+        if (in_degrees[c] == 0) source_list.push_back(c);
+        if (out_degree(c) == 0) sink_list.push_back(c);
+    }
+}
+
+int Condensation::augmentation_size() const {
+    if (component_count() <= 1) return 0;
+    return static_cast<int>(std::max(source_list.size(), sink_list.size()));
+}
+
+EdgeList Condensation::augmentation() const {
+    EdgeList result(vertex_count());
+    int count = component_count();
+    if (count <= 1) return result;
+
+    // Ниже истоков не больше, чем стоков; иначе то же строится на
+    // обращённом DAG, и добавленные дуги разворачиваются.
+    bool flip = source_list.size() > sink_list.size();
+    CSRGraph reversed;
+    if (flip) reversed = dag_graph.transpose();
+    const CSRGraph& dag = flip ? reversed : dag_graph;
+    std::span<const int> sources = flip ? sink_list : source_list;
+    std::span<const int> sinks = flip ? source_list : sink_list;
+
+    // Жадное паросочетание истоков со стоками: обход из каждого истока
+    // останавливается на первом ещё не достигнутом стоке, отметки
+    // сохраняются между обходами, поэтому каждая дуга просмотрена один раз.
+    struct Visitor : DfsVisitor {
+        const CSRGraph& dag;
+        int sink = -1;
+        explicit Visitor(const CSRGraph& dag) : dag(dag) {}
+        void enter(int v, int) {
+            if (dag.degree(v) == 0) sink = v;
+        }
+        bool stop() const { return sink != -1; }
+    };
+    Visitor visitor(dag);
+    DfsEngine dfs(count);
+    std::vector<uint8_t> matched(count, 0);
+    std::vector<int> s;
+    std::vector<int> t;
+    for (int source : sources) {
+        if (dfs.visited(source)) continue;
+        visitor.sink = -1;
+        dfs.run(dag, source, visitor);
+        if (visitor.sink == -1) continue;
+        s.push_back(source);
+        t.push_back(visitor.sink);
+        matched[source] = 1;
+        matched[visitor.sink] = 1;
+    }
+    // s и t: сначала пары s[i] ~> t[i], затем непарные истоки и стоки
+    int p = static_cast<int>(s.size());
+    for (int source : sources) {
+        if (!matched[source]) s.push_back(source);
+    }
+    for (int sink : sinks) {
+        if (!matched[sink]) t.push_back(sink);
+    }
+
+    auto add = [&](int from, int to) {
+        if (flip) std::swap(from, to);
+        result.add(representatives[from], representatives[to]);
+    };
+    // пары сцепляются в цикл, непарные сток и исток соединяются напрямую,
+    // лишние стоки встраиваются в цикл цепочкой
+    int a = static_cast<int>(s.size());
+    int b = static_cast<int>(t.size());
+    for (int i = 0; i + 1 < p; ++i) {
+        add(t[i], s[i + 1]);
+    }
+    for (int i = p; i < a; ++i) {
+        add(t[i], s[i]);
+    }
+    if (a == b) {
+        add(t[p - 1], s[0]);
+    } else {
+        add(t[p - 1], t[a]);
+        for (int i = a; i + 1 < b; ++i) {
+            add(t[i], t[i + 1]);
+        }
+        add(t[b - 1], s[0]);
+    }
+    return result;
+}
@@ -0,0 +1,52 @@
+#ifndef CONDENSATION_H
+#define CONDENSATION_H
+
+#include <span>
+#include <vector>
+#include "csr_graph.hpp"
+#include "edge_list.hpp"
+
+// Конденсация: граф компонент сильной связности в формате CSR. Дуги между
+// компонентами собираются из всех дуг исходного графа и очищаются от
+// повторов поразрядной сортировкой (normalize_directed), поэтому DAG
+// обычно на порядки меньше исходного графа и запросы достижимости
+// дешевле гонять по нему. Разметка comp_id может прийти от любого движка
+// (scc.h, parallel_scc.h): порядок номеров компонент не важен.
+class Condensation {
+public:
+    Condensation(const CSRGraph& graph, std::vector<int> comp_id, int comp_count);
+
+    int vertex_count() const { return static_cast<int>(comp_id.size()); }
+    int component_count() const { return dag_graph.vertex_count(); }
+    int component(int v) const { return comp_id[v]; }
+    // Наименьшая вершина компоненты c.
+    int representative(int c) const { return representatives[c]; }
+
+    // Дуги c -> d между разными компонентами, без повторов, соседи по
+    // возрастанию.
+    const CSRGraph& dag() const { return dag_graph; }
+    int in_degree(int c) const { return in_degrees[c]; }
+    int out_degree(int c) const { return dag_graph.degree(c); }
+
+    // Компоненты без входящих и без исходящих дуг; изолированная
+    // компонента есть в обоих списках.
+    std::span<const int> sources() const { return source_list; }
+    std::span<const int> sinks() const { return sink_list; }
+
+    // Наименьшее число дуг, после добавления которых граф станет сильно
+    // связным: max(истоки, стоки), 0 для одной компоненты.
+    int augmentation_size() const;
+    // Сами эти дуги (по Эсварану–Тарьяну, за линейное время) между
+    // представителями компонент, в номерах вершин исходного графа.
+    EdgeList augmentation() const;
+
+private:
+    std::vector<int> comp_id;
+    std::vector<int> representatives;
+    CSRGraph dag_graph;
+    std::vector<int> in_degrees;
+    std::vector<int> source_list;
+    std::vector<int> sink_list;
+};
+
+#endif
@@ -1,87 +1,95 @@
 #include "graph.h"
 #include <algorithm>
-#include <stack>
+#include "parallel.hpp"
+#include "parallel_scc.h"
+#include "scc.h"
 
-Graph::Graph(int vertices) : n(vertices) {
-    adj.resize(n);
-    adj_rev.resize(n);
+namespace {
+
+// Меньше дуг на поток не окупают обрезку и обходы по фронтам.
+constexpr int kMinArcsPerThread = 1 << 17;
+
+}  // namespace
+
+Graph::Graph(int vertices, Arena* scratch) : n(vertices), edges(vertices), adj_dirty(true), scratch(scratch) {
 }
 
-void Graph::add_edge(int from, int to) {
-    adj[from].push_back(to);
-    adj_rev[to].push_back(from);
+Graph::Graph(const CSRGraph& graph, Arena* scratch)
+    : n(graph.vertex_count()),
+      edges(graph.vertex_count()),
+      adj(graph),
+      adj_dirty(false),
+      scratch(scratch) {
 }
 
-void Graph::dfs1(int v, std::vector<bool>& visited, std::vector<int>& order) {
-    visited[v] = true;
-    for (int u : adj[v]) {
-        if (!visited[u]) {
-            dfs1(u, visited, order);
-        }
+void Graph::add_edge(int from, int to) {
+    if (edges.empty() && adj.arc_count() > 0) {
+        // граф был передан готовым CSR: восстанавливаем список рёбер
+        edges = adj.to_edge_list();
+    }
+    edges.add(from, to);
+    adj_dirty = true;
+    if (incremental) {
+        STATS_ADD(stats, "incremental_edges", 1);
+        incremental->add_edge(from, to);
     }
-    order.push_back(v);
 }
 
-void Graph::dfs2(int v, std::vector<bool>& visited, std::vector<int>& component) {
-    visited[v] = true;
-    component.push_back(v);
-    for (int u : adj_rev[v]) {
-        if (!visited[u]) {
-            dfs2(u, visited, component);
-        }
+void Graph::track_incrementally() {
+    if (incremental) return;
+    STATS_PHASE(stats, "track_incrementally");
+    incremental = std::make_unique<IncrementalSCC>(n);
+    if (edges.empty() && adj.arc_count() > 0) edges = adj.to_edge_list();
+    for (int i = 0; i < edges.size(); ++i) {
+        incremental->add_edge(edges.from[i], edges.to[i]);
     }
 }
 
+void Graph::build_adjacency() {
+    if (!adj_dirty) return;
+    STATS_PHASE(stats, "build_adjacency");
+    adj = CSRGraph::from_edges(edges, true);
+    adj_dirty = false;
+}
+
 int Graph::min_edges_to_make_strongly_connected() {
-    std::vector<bool> visited(n, false);
-    std::vector<int> order;
-    
-    for (int i = 0; i < n; ++i) {
-        if (!visited[i]) {
-            dfs1(i, visited, order);
-        }
-    }
-    
-    std::fill(visited.begin(), visited.end(), false);
-    std::vector<int> comp_id(n, -1);
-    std::vector<std::vector<int>> components;
-    
-    for (int i = order.size() - 1; i >= 0; --i) {
-        int v = order[i];
-        if (!visited[v]) {
-            std::vector<int> component;
-            dfs2(v, visited, component);
-            for (int u : component) {
-                comp_id[u] = components.size();
-            }
-            components.push_back(component);
-        }
-    }
-    
-    int comp_count = components.size();
-    if (comp_count == 1) {
-        return 0;
-    }
-    
-    std::vector<int> in_degree(comp_count, 0);
-    std::vector<int> out_degree(comp_count, 0);
-    
-    for (int v = 0; v < n; ++v) {
-        for (int u : adj[v]) {
-            if (comp_id[v] != comp_id[u]) {
-                out_degree[comp_id[v]]++;
-                in_degree[comp_id[u]]++;
-            }
-        }
-    }
-    
-    int sources = 0;
-    int sinks = 0;
-    
-    for (int i = 0; i < comp_count; ++i) {
-        if (in_degree[i] == 0) sources++;
-        if (out_degree[i] == 0) sinks++;
+    if (incremental) return incremental->augmentation_size();
+    return condensation(1).augmentation_size();
+}
+
+int Graph::min_edges_to_make_strongly_connected_parallel(unsigned threads) {
+    if (incremental) return incremental->augmentation_size();
+    return condensation(threads).augmentation_size();
+}
+
+Condensation Graph::condensation(unsigned threads) {
+    build_adjacency();
+    if (threads == 0) threads = default_thread_count();
+    threads = std::min<unsigned>(threads, adj.arc_count() / kMinArcsPerThread);
+
+    std::vector<int> comp_id(n);
+    int comp_count;
+    if (threads <= 1) {
+        // один проход Тарьяна–Пирса вместо двух проходов Косарайю
+        ScratchScope scope(scratch);
+        STATS_PHASE(stats, "scc_pass");
+        comp_count = strongly_connected_components(adj, comp_id, scope.resource());
+    } else {
+        STATS_PHASE(stats, "parallel");
+        STATS_ADD(stats, "threads", threads);
+        comp_count = strongly_connected_components_parallel(adj, comp_id, threads, stats);
     }
-    
-    return std::max(sources, sinks);
-}
\ No newline at end of file
+    STATS_ADD(stats, "arcs_scanned", adj.arc_count());
+
+    STATS_PHASE(stats, "condensation");
+    Condensation result(adj, std::move(comp_id), comp_count);
+    STATS_ADD(stats, "components", comp_count);
+    STATS_ADD(stats, "dag_arcs", result.dag().arc_count());
+    STATS_ADD(stats, "sources", result.sources().size());
+    STATS_ADD(stats, "sinks", result.sinks().size());
+    return result;
+}
+
+ReachabilityIndex Graph::build_reachability_index(unsigned threads) {
+    return ReachabilityIndex(condensation(threads));
+}
@@ -1,21 +1,45 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <memory>
 #include <vector>
+#include "arena.hpp"
+#include "condensation.h"
+#include "csr_graph.hpp"
+#include "incremental_scc.h"
+#include "reachability.h"
+#include "solver_stats.hpp"
 
 class Graph {
 public:
-    Graph(int vertices);
+    // scratch — арена для временных буферов; nullptr — обычная куча
+    Graph(int vertices, Arena* scratch = nullptr);
+    Graph(const CSRGraph& graph, Arena* scratch = nullptr);
     void add_edge(int from, int to);
     int min_edges_to_make_strongly_connected();
+    // То же с параллельным поиском компонент (parallel_scc.h) на threads
+    // потоках, 0 — все ядра; на малых графах — последовательный Пирс.
+    int min_edges_to_make_strongly_connected_parallel(unsigned threads = 0);
+    // Конденсация с дугами для достройки; threads — как выше, 1 — Пирс.
+    Condensation condensation(unsigned threads = 1);
+    // Индекс запросов «дойдёт ли a до b» по конденсации; после add_edge его
+    // нужно построить заново.
+    ReachabilityIndex build_reachability_index(unsigned threads = 1);
+    // Дальше add_edge поддерживает компоненты, истоки и стоки на лету
+    // (IncrementalSCC), и min_edges_* отвечают без обхода графа.
+    void track_incrementally();
+    SolverStats get_stats() const { return stats; }
     
 private:
     int n;
-    std::vector<std::vector<int>> adj;
-    std::vector<std::vector<int>> adj_rev;
+    EdgeList edges;
+    CSRGraph adj;
+    bool adj_dirty;
+    Arena* scratch;
+    std::unique_ptr<IncrementalSCC> incremental;
+    SolverStats stats{"strong_connectivity"};
     
-    void dfs1(int v, std::vector<bool>& visited, std::vector<int>& order);
-    void dfs2(int v, std::vector<bool>& visited, std::vector<int>& component);
+    void build_adjacency();
 };
 
-#endif
\ No newline at end of file
+#endif
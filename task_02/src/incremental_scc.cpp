@@ -0,0 +1,210 @@
+#include "incremental_scc.h"
+#include <algorithm>
+
+IncrementalSCC::IncrementalSCC(int vertices)
+    : comp(vertices),
+      out(vertices),
+      in(vertices),
+      same_level(vertices),
+      level(vertices, 0),
+      out_count(vertices, 0),
+      in_count(vertices, 0),
+      components(vertices),
+      sources(vertices),
+      sinks(vertices),
+      forward_mark(vertices, 0),
+      backward_mark(vertices, 0),
+      cycle_mark(vertices, 0) {
+}
+
+void IncrementalSCC::add_edge(int from, int to) {
+    int a = comp.find(from);
+    int b = comp.find(to);
+    if (a == b) return;
+
+    out[a].push_back(to);
+    in[b].push_back(from);
+    if (out_count[a]++ == 0) sinks--;
+    if (in_count[b]++ == 0) sources--;
+    arcs++;
+    while ((limit + 1) * (limit + 1) <= arcs) limit++;
+    if (level[a] < level[b]) return;
+
+    stamp++;
+    SearchResult result = search_backward(a);
+    if (result == kComplete && backward_mark[b] == stamp) {
+        // b ~> a внутри уровня: цикл среди найденного, уровни не меняются
+        merge(collect_cycle(a, b));
+        return;
+    }
+    if (result == kComplete && level[b] == level[a]) {
+        // путь b ~> a лежал бы целиком на этом уровне и нашёлся бы
+        same_level[b].push_back(from);
+        return;
+    }
+    // Конец поднимается до уровня начала, если обратный поиск исчерпан.
+    // Иначе — выше начала: тогда цикл, если он есть, прямой поиск поднимет
+    // целиком и дойдёт до a.
+    level[b] = result == kComplete ? level[a] : level[a] + 1;
+    same_level[b].clear();
+    if (!search_forward(b)) {
+        if (level[a] == level[b]) same_level[b].push_back(from);
+        return;
+    }
+    merge(collect_cycle(a, b));
+}
+
+IncrementalSCC::SearchResult IncrementalSCC::search_backward(int start) {
+    backward_mark[start] = stamp;
+    stack.assign(1, start);
+    long long traversed = 0;
+    while (!stack.empty()) {
+        int y = stack.back();
+        stack.pop_back();
+        std::vector<int>& list = same_level[y];
+        for (size_t i = 0; i < list.size(); ++i) {
+            int x = comp.find(list[i]);
+            if (x == y || level[x] != level[y]) {
+                // дуга стала внутренней или её начало ушло на другой
+                // уровень; если оно вернётся, прямой поиск добавит дугу снова
+                list[i--] = list.back();
+                list.pop_back();
+                continue;
+            }
+            if (++traversed > limit) return kLimit;
+            if (backward_mark[x] == stamp) continue;
+            backward_mark[x] = stamp;
+            stack.push_back(x);
+        }
+    }
+    return kComplete;
+}
+
+bool IncrementalSCC::search_forward(int start) {
+    // Все поднятые компоненты получают уровень start, поэтому каждая
+    // поднимается и просматривается не больше одного раза.
+    bool cycle = false;
+    forward_mark[start] = stamp;
+    stack.assign(1, start);
+    while (!stack.empty()) {
+        int x = stack.back();
+        stack.pop_back();
+        std::vector<int>& list = out[x];
+        for (size_t i = 0; i < list.size(); ++i) {
+            int y = comp.find(list[i]);
+            if (y == x) {
+                list[i--] = list.back();
+                list.pop_back();
+                continue;
+            }
+            if (backward_mark[y] == stamp) cycle = true;
+            if (level[y] == level[x]) {
+                same_level[y].push_back(x);
+            } else if (level[y] < level[x]) {
+                level[y] = level[x];
+                same_level[y].assign(1, x);
+                forward_mark[y] = stamp;
+                stack.push_back(y);
+            }
+        }
+    }
+    return cycle;
+}
+
+std::vector<int> IncrementalSCC::collect_cycle(int from_root, int to_root) {
+    // Цикл через дугу from -> to целиком на уровне to и среди компонент,
+    // пройденных поисками. Обратным поиском от from по ним собираются дуги
+    // внутри уровня, затем по этим дугам — всё, что достижимо из to.
+    int top = level[to_root];
+    auto searched = [&](int c) { return forward_mark[c] == stamp || backward_mark[c] == stamp; };
+    cycle_arcs.clear();
+    cycle_mark[from_root] = stamp;
+    stack.assign(1, from_root);
+    while (!stack.empty()) {
+        int y = stack.back();
+        stack.pop_back();
+        for (int tail : same_level[y]) {
+            int x = comp.find(tail);
+            if (x == y || level[x] != top || !searched(x)) continue;
+            cycle_arcs.push_back({x, y});
+            if (cycle_mark[x] == stamp) continue;
+            cycle_mark[x] = stamp;
+            stack.push_back(x);
+        }
+    }
+    std::sort(cycle_arcs.begin(), cycle_arcs.end());
+
+    // новая метка отмечает саму группу для merge
+    stamp++;
+    std::vector<int> group = {to_root};
+    cycle_mark[to_root] = stamp;
+    for (size_t head = 0; head < group.size(); ++head) {
+        auto it = std::lower_bound(cycle_arcs.begin(), cycle_arcs.end(), std::pair<int, int>(group[head], -1));
+        for (; it != cycle_arcs.end() && it->first == group[head]; ++it) {
+            if (cycle_mark[it->second] == stamp) continue;
+            cycle_mark[it->second] = stamp;
+            group.push_back(it->second);
+        }
+    }
+    return group;
+}
+
+int IncrementalSCC::merge(const std::vector<int>& group) {
+    auto in_group = [&](int c) { return cycle_mark[c] == stamp; };
+    int big = *std::max_element(group.begin(), group.end(), [&](int x, int y) {
+        return out[x].size() + in[x].size() < out[y].size() + in[y].size();
+    });
+
+    // Дуги внутри группы перестают быть дугами конденсации. Каждая из них
+    // видна ровно один раз: в исходящих меньшей компоненты или во входящих
+    // меньшей компоненты, если начало в большой.
+    int internal = 0;
+    int total_in = 0;
+    int total_out = 0;
+    for (int c : group) {
+        total_in += in_count[c];
+        total_out += out_count[c];
+        if (in_count[c] == 0) sources--;
+        if (out_count[c] == 0) sinks--;
+        if (c == big) continue;
+        for (int x : out[c]) {
+            int d = comp.find(x);
+            if (d == c) continue;
+            if (in_group(d)) {
+                internal++;
+            } else {
+                out[big].push_back(x);
+            }
+        }
+        for (int x : in[c]) {
+            int d = comp.find(x);
+            if (d == c) continue;
+            if (d == big) {
+                internal++;
+            } else if (!in_group(d)) {
+                in[big].push_back(x);
+            }
+        }
+        same_level[big].insert(same_level[big].end(), same_level[c].begin(), same_level[c].end());
+        std::vector<int>().swap(out[c]);
+        std::vector<int>().swap(in[c]);
+        std::vector<int>().swap(same_level[c]);
+    }
+
+    int root = big;
+    for (int c : group) {
+        root = comp.unite(root, c);
+    }
+    if (root != big) {
+        out[root].swap(out[big]);
+        in[root].swap(in[big]);
+        same_level[root].swap(same_level[big]);
+        level[root] = level[big];
+    }
+    in_count[root] = total_in - internal;
+    out_count[root] = total_out - internal;
+    if (in_count[root] == 0) sources++;
+    if (out_count[root] == 0) sinks++;
+    components -= static_cast<int>(group.size()) - 1;
+    return root;
+}
@@ -0,0 +1,72 @@
+#ifndef INCREMENTAL_SCC_H
+#define INCREMENTAL_SCC_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "union_find.hpp"
+
+// Компоненты сильной связности и число истоков и стоков конденсации при
+// добавлении дуг без повторного обхода графа.
+//
+// Компоненты — множества системы непересекающихся множеств. Вместо полного
+// топологического порядка у компонент есть уровни, не убывающие вдоль дуг
+// (Бендер, Файнман, Гилберт, Тарьян). Дуга вверх по уровням ничего не
+// проверяет. Иначе обратный поиск от начала дуги идёт только по дугам
+// внутри уровня и не дальше sqrt(m) дуг; если он исчерпан и не встретил
+// конец, либо упёрся в предел, уровень конца поднимается, и прямой поиск
+// поднимает всё, что из него достижимо ниже этого уровня. Цикл, замкнутый
+// дугой, лежит в пройденных поисками компонентах, поэтому склейка ищется
+// только среди них. Списки дуг компонент сливаются от меньшего к большему.
+// Всего O(m^{3/2}) на m дуг.
+class IncrementalSCC {
+public:
+    explicit IncrementalSCC(int vertices);
+
+    void add_edge(int from, int to);
+
+    int component_count() const { return components; }
+    int component(int v) const { return comp.find(v); }
+    bool strongly_connected(int a, int b) const { return comp.same(a, b); }
+    int source_count() const { return sources; }
+    int sink_count() const { return sinks; }
+    // То же, что Condensation::augmentation_size.
+    int augmentation_size() const { return components == 1 ? 0 : std::max(sources, sinks); }
+
+private:
+    enum SearchResult { kComplete, kLimit };
+
+    mutable UnionFind comp;
+    // Данные компоненты лежат в корне её множества. Дуги хранятся концами в
+    // исходных вершинах; после слияний часть из них становится внутренней
+    // и выбрасывается при обходе. same_level — входящие дуги из компонент
+    // того же уровня: по ним идёт обратный поиск.
+    std::vector<std::vector<int>> out;
+    std::vector<std::vector<int>> in;
+    std::vector<std::vector<int>> same_level;
+    std::vector<int> level;
+    // дуги между разными компонентами с учётом кратности
+    std::vector<int> out_count;
+    std::vector<int> in_count;
+    int components;
+    int sources;
+    int sinks;
+    long long arcs = 0;
+    // предел обратного поиска, floor(sqrt(arcs))
+    long long limit = 0;
+
+    // метки поисков, переиспользуются между дугами
+    std::vector<int> forward_mark;
+    std::vector<int> backward_mark;
+    std::vector<int> cycle_mark;
+    int stamp = 0;
+    std::vector<int> stack;
+    std::vector<std::pair<int, int>> cycle_arcs;
+
+    SearchResult search_backward(int start);
+    bool search_forward(int start);
+    std::vector<int> collect_cycle(int from_root, int to_root);
+    int merge(const std::vector<int>& group);
+};
+
+#endif
@@ -1,19 +1,27 @@
-#include <iostream>
 #include "graph.h"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "graph_file.hpp"
+#include "driver_args.hpp"
 
-int main() {
-    int n, m;
-    std::cin >> n >> m;
+CSRGraph read_graph(unsigned threads) {
+    FastReader in;
+    int n = in.read_int();
+    int m = in.read_int();
     
-    Graph g(n);
-    
-    for (int i = 0; i < m; ++i) {
-        int a, b;
-        std::cin >> a >> b;
-        g.add_edge(a - 1, b - 1);
-    }
+    EdgeList edges = read_edge_list(in, n, m, false, threads);
+    return CSRGraph::from_edges(edges, true, false, threads);
+}
+
+int main(int argc, char* argv[]) {
+    FastWriter out;
+    // --graph <file>: граф из бинарного файла (tools/graph_convert), без разбора текста
+    DriverArgs args(argc, argv);
+    Graph g(args.graph_path ? load_graph_file(args.graph_path, true, false) : read_graph(args.threads));
     
-    std::cout << g.min_edges_to_make_strongly_connected() << std::endl;
+    out << g.min_edges_to_make_strongly_connected_parallel(args.threads) << '\n';
     
+    args.dump_stats(g.get_stats());
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "parallel_scc.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "concurrent_union_find.hpp"
+#include "parallel.hpp"
+#include "scc.h"
+
+namespace {
+
+constexpr int kAlive = -1;
+// Меньший фронт обходится в вызывающем потоке: на графах с большим
+// диаметром запуск потоков на каждом уровне дороже самого уровня.
+constexpr size_t kMinFrontierPerThread = 1 << 12;
+
+// Один уровень обхода: f(v, next) для вершин фронта по кускам, новые
+// фронты кусков склеиваются.
+template <class F>
+std::vector<int> expand(const std::vector<int>& frontier, unsigned threads, F&& f) {
+    unsigned parts = std::clamp<size_t>(frontier.size() / kMinFrontierPerThread, 1, threads);
+    std::vector<std::vector<int>> next(parts);
+    parallel_blocks(frontier.size(), parts, [&](unsigned part, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            f(frontier[i], next[part]);
+        }
+    });
+    for (unsigned part = 1; part < parts; ++part) {
+        next[0].insert(next[0].end(), next[part].begin(), next[part].end());
+    }
+    return std::move(next[0]);
+}
+
+}  // namespace
+
+int strongly_connected_components_parallel(const CSRGraph& graph, std::span<int> comp_id, unsigned threads,
+                                           [[maybe_unused]] SolverStats& stats) {
+    int n = graph.vertex_count();
+    STATS_CLOCK(stats);
+    CSRGraph reverse = graph.transpose(threads);
+    auto out_offsets = graph.offsets();
+    auto out_targets = graph.targets();
+    auto in_offsets = reverse.offsets();
+    auto in_targets = reverse.targets();
+    STATS_LAP("transpose");
+
+    // comp_id[v] — kAlive, пока компонента v не найдена, затем одна из
+    // вершин компоненты; вершину забирает тот поток, чей CAS успел первым.
+    parallel_blocks(n, threads, [&](unsigned, size_t begin, size_t end) {
+        std::fill(comp_id.begin() + begin, comp_id.begin() + end, kAlive);
+    });
+    auto alive = [&](int v) { return std::atomic_ref<int>(comp_id[v]).load(std::memory_order_relaxed) == kAlive; };
+    auto claim = [&](int v, int representative) {
+        int expected = kAlive;
+        return std::atomic_ref<int>(comp_id[v]).compare_exchange_strong(expected, representative,
+                                                                        std::memory_order_relaxed);
+    };
+
+    // Обрезка: степени считаются по живым соседям без петель, вершина с
+    // нулевой входящей или исходящей степенью — отдельная компонента, её
+    // снятие уменьшает степени соседей.
+    auto in_degree = std::make_unique<std::atomic<int>[]>(n);
+    auto out_degree = std::make_unique<std::atomic<int>[]>(n);
+    auto trim = [&] {
+        std::vector<std::vector<int>> seeds(threads);
+        parallel_vertex_blocks(out_offsets, threads, [&](unsigned part, int begin, int end) {
+            for (int v = begin; v < end; ++v) {
+                if (!alive(v)) continue;
+                int out = 0;
+                for (uint32_t i = out_offsets[v]; i < out_offsets[v + 1]; ++i) {
+                    int w = out_targets[i];
+                    out += w != v && alive(w);
+                }
+                int in = 0;
+                for (uint32_t i = in_offsets[v]; i < in_offsets[v + 1]; ++i) {
+                    int w = in_targets[i];
+                    in += w != v && alive(w);
+                }
+                out_degree[v].store(out, std::memory_order_relaxed);
+                in_degree[v].store(in, std::memory_order_relaxed);
+                if (in == 0 || out == 0) seeds[part].push_back(v);
+            }
+        });
+        std::vector<int> frontier;
+        for (std::vector<int>& part : seeds) {
+            frontier.insert(frontier.end(), part.begin(), part.end());
+        }
+        for (int v : frontier) {
+            comp_id[v] = v;
+        }
+        while (!frontier.empty()) {
+            STATS_ADD(stats, "trimmed", frontier.size());
+            frontier = expand(frontier, threads, [&](int v, std::vector<int>& next) {
+                for (uint32_t i = out_offsets[v]; i < out_offsets[v + 1]; ++i) {
+                    int w = out_targets[i];
+                    if (w != v && in_degree[w].fetch_sub(1, std::memory_order_relaxed) == 1 && claim(w, w)) {
+                        next.push_back(w);
+                    }
+                }
+                for (uint32_t i = in_offsets[v]; i < in_offsets[v + 1]; ++i) {
+                    int w = in_targets[i];
+                    if (w != v && out_degree[w].fetch_sub(1, std::memory_order_relaxed) == 1 && claim(w, w)) {
+                        next.push_back(w);
+                    }
+                }
+            });
+        }
+    };
+    trim();
+    STATS_LAP("trim");
+
+    // Опорная вершина — живая с наибольшим произведением степеней: она
+    // почти наверняка лежит в гигантской компоненте.
+    std::vector<std::pair<long long, int>> best(threads, {-1, -1});
+    parallel_blocks(n, threads, [&](unsigned part, size_t begin, size_t end) {
+        for (size_t v = begin; v < end; ++v) {
+            if (!alive(v)) continue;
+            long long score = 1LL * in_degree[v].load(std::memory_order_relaxed) *
+                              out_degree[v].load(std::memory_order_relaxed);
+            if (score > best[part].first) best[part] = {score, static_cast<int>(v)};
+        }
+    });
+    int pivot = std::max_element(best.begin(), best.end())->second;
+
+    if (pivot != -1) {
+        // Компонента опорной вершины — вершины, из которых она достижима
+        // обратным обходом внутри её прямой достижимости: путь до опорной
+        // вершины из такой вершины целиком лежит в прямой достижимости.
+        std::vector<uint8_t> forward(n, 0);
+        forward[pivot] = 1;
+        std::vector<int> frontier = {pivot};
+        while (!frontier.empty()) {
+            frontier = expand(frontier, threads, [&](int v, std::vector<int>& next) {
+                for (uint32_t i = out_offsets[v]; i < out_offsets[v + 1]; ++i) {
+                    int w = out_targets[i];
+                    if (alive(w) && !std::atomic_ref<uint8_t>(forward[w]).exchange(1, std::memory_order_relaxed)) {
+                        next.push_back(w);
+                    }
+                }
+            });
+        }
+        STATS_LAP("forward");
+
+        claim(pivot, pivot);
+        frontier = {pivot};
+        while (!frontier.empty()) {
+            STATS_ADD(stats, "giant_component", frontier.size());
+            frontier = expand(frontier, threads, [&](int v, std::vector<int>& next) {
+                for (uint32_t i = in_offsets[v]; i < in_offsets[v + 1]; ++i) {
+                    int w = in_targets[i];
+                    if (forward[w] && claim(w, pivot)) next.push_back(w);
+                }
+            });
+        }
+        STATS_LAP("backward");
+        trim();
+        STATS_LAP("trim");
+    }
+
+    // Остаток делится на слабые компоненты; между ними нет живых дуг,
+    // поэтому каждая разбирается последовательным Пирсом на своём подграфе.
+    ConcurrentUnionFind weak(n);
+    parallel_vertex_blocks(out_offsets, threads, [&](unsigned, int begin, int end) {
+        for (int v = begin; v < end; ++v) {
+            if (!alive(v)) continue;
+            for (uint32_t i = out_offsets[v]; i < out_offsets[v + 1]; ++i) {
+                if (alive(out_targets[i])) weak.unite(v, out_targets[i]);
+            }
+        }
+    });
+    std::vector<int> group_offsets(n + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        if (alive(v)) group_offsets[weak.find(v) + 1]++;
+    }
+    std::vector<int> roots;
+    for (int v = 0; v < n; ++v) {
+        if (group_offsets[v + 1] > 0) roots.push_back(v);
+    }
+    std::stable_sort(roots.begin(), roots.end(),
+                     [&](int a, int b) { return group_offsets[a + 1] > group_offsets[b + 1]; });
+    for (int v = 0; v < n; ++v) {
+        group_offsets[v + 1] += group_offsets[v];
+    }
+    std::vector<int> members(group_offsets[n]);
+    std::vector<int> fill(group_offsets.begin(), group_offsets.end() - 1);
+    for (int v = 0; v < n; ++v) {
+        if (alive(v)) members[fill[weak.find(v)]++] = v;
+    }
+    STATS_ADD(stats, "weak_groups", roots.size());
+    STATS_LAP("weak_groups");
+
+    // local — номер вершины внутри её группы; группы не пересекаются, так
+    // что потоки пишут в общий массив без гонок.
+    std::vector<int> local(n, -1);
+    std::atomic<size_t> next_root{0};
+    parallel_blocks(threads, threads, [&](unsigned, size_t, size_t) {
+        std::vector<int> local_comp;
+        std::vector<int> representative;
+        for (size_t k = next_root++; k < roots.size(); k = next_root++) {
+            std::span<const int> group(members.data() + group_offsets[roots[k]],
+                                       group_offsets[roots[k] + 1] - group_offsets[roots[k]]);
+            int size = group.size();
+            for (int i = 0; i < size; ++i) {
+                local[group[i]] = i;
+            }
+            EdgeList arcs(size);
+            for (int v : group) {
+                for (uint32_t i = out_offsets[v]; i < out_offsets[v + 1]; ++i) {
+                    int w = out_targets[i];
+                    if (alive(w)) arcs.add(local[v], local[w]);
+                }
+            }
+            local_comp.assign(size, -1);
+            int count = strongly_connected_components(CSRGraph::from_edges(arcs, true), local_comp);
+            representative.assign(count, -1);
+            for (int i = 0; i < size; ++i) {
+                int& r = representative[local_comp[i]];
+                if (r == -1) r = group[i];
+            }
+            for (int i = 0; i < size; ++i) {
+                std::atomic_ref<int>(comp_id[group[i]]).store(representative[local_comp[i]],
+                                                              std::memory_order_relaxed);
+            }
+        }
+    });
+    STATS_LAP("weak_scc");
+
+    // представители -> номера по наименьшей вершине компоненты
+    std::vector<int> id_of(n, -1);
+    int count = 0;
+    for (int v = 0; v < n; ++v) {
+        int& id = id_of[comp_id[v]];
+        if (id == -1) id = count++;
+        comp_id[v] = id;
+    }
+    STATS_LAP("renumber");
+    return count;
+}
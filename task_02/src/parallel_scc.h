@@ -0,0 +1,20 @@
+#ifndef PARALLEL_SCC_H
+#define PARALLEL_SCC_H
+
+#include <span>
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
+
+// Сильно связные компоненты на threads потоках по схеме «обрезка — прямой и
+// обратный обход — раскраска»: вершины без входящих или исходящих дуг
+// снимаются как одиночные компоненты, гигантская компонента находится
+// пересечением прямой и обратной достижимости от одной опорной вершины,
+// остаток делится на слабые компоненты, которые разбираются
+// последовательным Пирсом (scc.h) одновременно. comp_id — тот же плоский
+// массив, что у strongly_connected_components, но номера идут по
+// наименьшей вершине компоненты, а не в топологическом порядке.
+// Возвращает число компонент.
+int strongly_connected_components_parallel(const CSRGraph& graph, std::span<int> comp_id, unsigned threads,
+                                           SolverStats& stats);
+
+#endif
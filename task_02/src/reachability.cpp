@@ -0,0 +1,184 @@
+#include "reachability.h"
+#include <algorithm>
+#include <numeric>
+#include "edge_normalize.hpp"
+#include "parallel.hpp"
+
+namespace {
+
+// Меньший пакет на поток не окупает запуск потока.
+constexpr size_t kMinQueriesPerThread = 1 << 14;
+
+}  // namespace
+
+ReachabilityIndex::ReachabilityIndex(const Condensation& condensation, size_t bitset_bytes)
+    : comp_id(condensation.vertex_count()) {
+    int n = condensation.vertex_count();
+    int count = condensation.component_count();
+    const CSRGraph& dag = condensation.dag();
+    for (int v = 0; v < n; ++v) {
+        comp_id[v] = condensation.component(v);
+    }
+    STATS_ADD(stats, "components", count);
+
+    // Кан: места в порядке, затем DAG в номерах мест — дуги ведут вперёд,
+    // соседи по возрастанию
+    CSRGraph ordered;
+    {
+        STATS_PHASE(stats, "topological_order");
+        std::vector<int> in_degree(count);
+        std::vector<int> order;
+        order.reserve(count);
+        for (int c = 0; c < count; ++c) {
+            in_degree[c] = condensation.in_degree(c);
+            if (in_degree[c] == 0) order.push_back(c);
+        }
+        for (size_t head = 0; head < order.size(); ++head) {
+            for (int d : dag.neighbors(order[head])) {
+                if (--in_degree[d] == 0) order.push_back(d);
+            }
+        }
+        position.resize(count);
+        for (int p = 0; p < count; ++p) {
+            position[order[p]] = p;
+        }
+        EdgeList arcs(count);
+        arcs.reserve(dag.arc_count());
+        for (int c = 0; c < count; ++c) {
+            for (int d : dag.neighbors(c)) {
+                arcs.add(position[c], position[d]);
+            }
+        }
+        normalize_directed(arcs);
+        ordered = CSRGraph::from_edges(arcs, true);
+    }
+
+    size_t row_words = (static_cast<size_t>(count) + 63) / 64;
+    if (row_words * count * sizeof(uint64_t) <= bitset_bytes) {
+        STATS_PHASE(stats, "bitsets");
+        build_bitsets(ordered, row_words);
+        STATS_ADD(stats, "bitset_bytes", rows.size() * sizeof(uint64_t));
+    } else {
+        STATS_PHASE(stats, "labels");
+        build_labels(ordered);
+        STATS_ADD(stats, "label_entries", out_labels.size() + in_labels.size());
+    }
+}
+
+void ReachabilityIndex::build_bitsets(const CSRGraph& ordered, size_t row_words) {
+    int count = ordered.vertex_count();
+    words = row_words;
+    rows.assign(words * count, 0);
+    // Строка места p — она сама и строки её соседей. Всё достижимое из p
+    // лежит не раньше p, поэтому ИЛИ начинается со слова соседа; сосед,
+    // уже достижимый через меньшего соседа, пропускается.
+    for (int p = count - 1; p >= 0; --p) {
+        uint64_t* row = rows.data() + words * p;
+        row[p / 64] |= uint64_t(1) << (p % 64);
+        for (int q : ordered.neighbors(p)) {
+            if (row[q / 64] >> (q % 64) & 1) continue;
+            const uint64_t* source = rows.data() + words * q;
+            for (size_t w = q / 64; w < words; ++w) {
+                row[w] |= source[w];
+            }
+        }
+    }
+}
+
+void ReachabilityIndex::build_labels(const CSRGraph& ordered) {
+    int count = ordered.vertex_count();
+    CSRGraph reverse = ordered.transpose();
+
+    // Ориентиры — сначала компоненты с наибольшим произведением степеней:
+    // через них проходит больше путей, и поздние обходы раньше обрезаются.
+    std::vector<int> landmarks(count);
+    std::iota(landmarks.begin(), landmarks.end(), 0);
+    auto weight = [&](int p) { return 1LL * (ordered.degree(p) + 1) * (reverse.degree(p) + 1); };
+    std::stable_sort(landmarks.begin(), landmarks.end(), [&](int x, int y) { return weight(x) > weight(y); });
+
+    // out_lists[p] — ориентиры, достижимые из p; in_lists[p] — ориентиры,
+    // из которых достижимо p. Ранги добавляются по возрастанию.
+    std::vector<std::vector<int>> out_lists(count);
+    std::vector<std::vector<int>> in_lists(count);
+    std::vector<uint8_t> marked(count, 0);
+    std::vector<int> seen(count, -1);
+    int stamp = 0;
+    std::vector<int> queue;
+
+    // Обход из ориентира; вершина, путь до которой уже покрыт прежним
+    // ориентиром (есть общий ранг с помеченными), не получает метку и не
+    // раскрывается.
+    auto sweep = [&](int rank, int start, const CSRGraph& graph, std::vector<std::vector<int>>& covered,
+                     std::vector<std::vector<int>>& labels) {
+        for (int x : covered[start]) marked[x] = 1;
+        queue.assign(1, start);
+        seen[start] = ++stamp;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int u = queue[head];
+            const std::vector<int>& list = labels[u];
+            if (std::any_of(list.begin(), list.end(), [&](int x) { return marked[x]; })) continue;
+            labels[u].push_back(rank);
+            for (int w : graph.neighbors(u)) {
+                if (seen[w] == stamp) continue;
+                seen[w] = stamp;
+                queue.push_back(w);
+            }
+        }
+        for (int x : covered[start]) marked[x] = 0;
+    };
+    for (int rank = 0; rank < count; ++rank) {
+        int landmark = landmarks[rank];
+        sweep(rank, landmark, ordered, out_lists, in_lists);
+        sweep(rank, landmark, reverse, in_lists, out_lists);
+    }
+
+    auto flatten = [&](std::vector<std::vector<int>>& lists, std::vector<int>& offsets, std::vector<int>& labels) {
+        offsets.assign(count + 1, 0);
+        for (int p = 0; p < count; ++p) {
+            offsets[p + 1] = offsets[p] + static_cast<int>(lists[p].size());
+        }
+        labels.reserve(offsets[count]);
+        for (std::vector<int>& list : lists) {
+            labels.insert(labels.end(), list.begin(), list.end());
+            std::vector<int>().swap(list);
+        }
+    };
+    flatten(out_lists, out_offsets, out_labels);
+    flatten(in_lists, in_offsets, in_labels);
+}
+
+bool ReachabilityIndex::reachable_components(int c, int d) const {
+    int p = position[c];
+    int q = position[d];
+    if (p == q) return true;
+    if (q < p) return false;
+    if (uses_bitsets()) {
+        return rows[words * p + q / 64] >> (q % 64) & 1;
+    }
+    // пересечение двух отсортированных списков рангов
+    const int* x = out_labels.data() + out_offsets[p];
+    const int* x_end = out_labels.data() + out_offsets[p + 1];
+    const int* y = in_labels.data() + in_offsets[q];
+    const int* y_end = in_labels.data() + in_offsets[q + 1];
+    while (x != x_end && y != y_end) {
+        if (*x == *y) return true;
+        if (*x < *y) {
+            ++x;
+        } else {
+            ++y;
+        }
+    }
+    return false;
+}
+
+std::vector<uint8_t> ReachabilityIndex::reachable(const EdgeList& queries, unsigned threads) const {
+    std::vector<uint8_t> answers(queries.size());
+    if (threads == 0) threads = default_thread_count();
+    threads = std::clamp<size_t>(answers.size() / kMinQueriesPerThread, 1, threads);
+    parallel_blocks(answers.size(), threads, [&](unsigned, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            answers[i] = reachable(queries.from[i], queries.to[i]);
+        }
+    });
+    return answers;
+}
@@ -0,0 +1,55 @@
+#ifndef REACHABILITY_H
+#define REACHABILITY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "condensation.h"
+#include "edge_list.hpp"
+#include "solver_stats.hpp"
+
+// Индекс для запросов «достижима ли b из a» по конденсации. Компоненты
+// нумеруются в топологическом порядке, и дуга назад по порядку сразу даёт
+// «нет». Пока таблица помещается в bitset_bytes, у каждой компоненты есть
+// строка бит достижимых компонент: строки собираются от стоков к истокам
+// побитовым ИЛИ по 64-битным словам, запрос — один бит. Для больших DAG
+// строятся 2-hop метки (pruned landmark labeling): у компоненты —
+// отсортированные списки ориентиров, до которых она доходит и которые
+// доходят до неё, и запрос — пересечение двух коротких списков.
+class ReachabilityIndex {
+public:
+    static constexpr size_t kDefaultBitsetBytes = size_t(256) << 20;
+
+    explicit ReachabilityIndex(const Condensation& condensation, size_t bitset_bytes = kDefaultBitsetBytes);
+
+    bool reachable(int a, int b) const {
+        return reachable_components(comp_id[a], comp_id[b]);
+    }
+    // Пакет запросов: ответ i — reachable(queries.from[i], queries.to[i]).
+    // Запросы делятся между threads потоками, 0 — все ядра.
+    std::vector<uint8_t> reachable(const EdgeList& queries, unsigned threads = 1) const;
+
+    bool uses_bitsets() const { return words > 0; }
+    SolverStats get_stats() const { return stats; }
+
+private:
+    std::vector<int> comp_id;
+    // место компоненты в топологическом порядке
+    std::vector<int> position;
+    // строки по местам в порядке, words слов на строку
+    size_t words = 0;
+    std::vector<uint64_t> rows;
+    // метки по местам в порядке: ранги ориентиров по возрастанию
+    std::vector<int> out_offsets;
+    std::vector<int> out_labels;
+    std::vector<int> in_offsets;
+    std::vector<int> in_labels;
+
+    SolverStats stats{"reachability"};
+
+    bool reachable_components(int c, int d) const;
+    void build_bitsets(const CSRGraph& ordered, size_t row_words);
+    void build_labels(const CSRGraph& ordered);
+};
+
+#endif
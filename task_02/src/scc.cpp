@@ -0,0 +1,64 @@
+#include "scc.h"
+#include "dfs.hpp"
+
+int strongly_connected_components(const CSRGraph& graph, std::span<int> comp_id,
+                                  std::pmr::memory_resource* resource) {
+    int n = graph.vertex_count();
+
+    // rindex[v] — номер входа, затем минимум по достижимым незавершённым
+    // вершинам; завершённая вершина получает номер компоненты c, который
+    // идёт от n - 1 вниз и всегда больше номеров входа, поэтому дуги в
+    // готовые компоненты сравнение отсекает само. Номера входа освобождаются
+    // вместе с компонентой, так что index никогда не догоняет c.
+    struct Visitor : DfsVisitor {
+        std::span<int> rindex;
+        std::pmr::vector<uint8_t> root;
+        std::pmr::vector<int> stack;
+        int index = 0;
+        int c;
+
+        Visitor(std::span<int> rindex, int n, std::pmr::memory_resource* resource)
+            : rindex(rindex), root(n, 0, resource), stack(resource), c(n - 1) {}
+
+        void enter(int v, int) {
+            rindex[v] = index++;
+            root[v] = 1;
+        }
+
+        void tree_edge(int v, int child) { lower(v, child); }
+
+        void non_tree_edge(int v, int to, bool) { lower(v, to); }
+
+        void lower(int v, int to) {
+            if (rindex[to] < rindex[v]) {
+                rindex[v] = rindex[to];
+                root[v] = 0;
+            }
+        }
+
+        void leave(int v, int) {
+            if (!root[v]) {
+                stack.push_back(v);
+                return;
+            }
+            index--;
+            while (!stack.empty() && rindex[v] <= rindex[stack.back()]) {
+                rindex[stack.back()] = c;
+                stack.pop_back();
+                index--;
+            }
+            rindex[v] = c--;
+        }
+    };
+
+    Visitor visitor(comp_id, n, resource);
+    DfsEngine dfs(resource);
+    dfs.reset(n);
+    for (int v = 0; v < n; ++v) {
+        if (!dfs.visited(v)) dfs.run(graph, v, visitor);
+    }
+    for (int v = 0; v < n; ++v) {
+        comp_id[v] = n - 1 - comp_id[v];
+    }
+    return n - 1 - visitor.c;
+}
@@ -0,0 +1,17 @@
+#ifndef SCC_H
+#define SCC_H
+
+#include <memory_resource>
+#include <span>
+#include "csr_graph.hpp"
+
+// Сильно связные компоненты за один проход в глубину без транспонированного
+// графа (вариант Тарьяна по Пирсу): один массив rindex служит и номером
+// входа, и нижней меткой, и в конце номером компоненты. comp_id (размера n)
+// получает номера компонент в порядке их завершения — это обратный
+// топологический порядок конденсации, 0 — сток. Возвращает число компонент.
+// Стек обхода и стек вершин берутся из resource.
+int strongly_connected_components(const CSRGraph& graph, std::span<int> comp_id,
+                                  std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+#endif
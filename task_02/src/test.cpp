@@ -1,6 +1,15 @@
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include "condensation.h"
 #include "graph.h"
+#include "graph_generators.hpp"
+#include "incremental_scc.h"
+#include "parallel_scc.h"
+#include "reachability.h"
+#include "scc.h"
 
 void test_example1() {
     Graph g(2);
@@ -99,6 +108,277 @@ void test_diamond() {
     std::cout << "test_diamond: OK" << std::endl;
 }
 
+void test_from_csr() {
+    EdgeList edges(4);
+    edges.add(0, 1);
+    edges.add(2, 1);
+    edges.add(1, 3);
+    Graph g(CSRGraph::from_edges(edges, true));
+    
+    assert(g.min_edges_to_make_strongly_connected() == 2);
+    g.add_edge(3, 0);
+    g.add_edge(1, 2);
+    assert(g.min_edges_to_make_strongly_connected() == 0);
+    std::cout << "test_from_csr: OK" << std::endl;
+}
+
+// Компоненты по определению: u и v вместе, если достижимы друг из друга.
+static std::vector<std::vector<char>> brute_reachability(const EdgeList& edges) {
+    std::vector<std::vector<char>> reach(edges.n, std::vector<char>(edges.n, 0));
+    for (int v = 0; v < edges.n; ++v) reach[v][v] = 1;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int i = 0; i < edges.size(); ++i) {
+            for (int w = 0; w < edges.n; ++w) {
+                if (reach[edges.to[i]][w] && !reach[edges.from[i]][w]) {
+                    reach[edges.from[i]][w] = 1;
+                    changed = true;
+                }
+            }
+        }
+    }
+    return reach;
+}
+
+void test_scc_random() {
+    for (int seed = 1; seed <= 40; ++seed) {
+        int n = 5 + seed % 20;
+        EdgeList edges = random_graph(n, n + seed % 13, seed);
+        CSRGraph graph = CSRGraph::from_edges(edges, true);
+        std::vector<int> comp_id(n, -1);
+        int count = strongly_connected_components(graph, comp_id);
+        
+        std::vector<std::vector<char>> reach = brute_reachability(edges);
+        for (int u = 0; u < n; ++u) {
+            assert(comp_id[u] >= 0 && comp_id[u] < count);
+            for (int v = 0; v < n; ++v) {
+                assert((comp_id[u] == comp_id[v]) == (reach[u][v] && reach[v][u]));
+            }
+        }
+        // обратный топологический порядок: дуги ведут к меньшим номерам
+        for (int i = 0; i < edges.size(); ++i) {
+            assert(comp_id[edges.from[i]] >= comp_id[edges.to[i]]);
+        }
+    }
+    std::cout << "test_scc_random: OK" << std::endl;
+}
+
+void test_scc_deep() {
+    // длинный цикл и длинная цепочка: обход не упирается в стек вызовов
+    int n = 1000000;
+    EdgeList cycle = chain_graph(n);
+    cycle.add(n - 1, 0);
+    std::vector<int> comp_id(n);
+    assert(strongly_connected_components(CSRGraph::from_edges(cycle, true), comp_id) == 1);
+    assert(strongly_connected_components(CSRGraph::from_edges(chain_graph(n), true), comp_id) == n);
+    assert(comp_id[0] == n - 1 && comp_id[n - 1] == 0);
+    std::cout << "test_scc_deep: OK" << std::endl;
+}
+
+// Номера компонент по наименьшей вершине — чтобы сравнивать разбиения.
+static std::vector<int> canonical(const std::vector<int>& comp_id) {
+    std::vector<int> id_of(comp_id.size(), -1);
+    std::vector<int> result(comp_id.size());
+    int count = 0;
+    for (size_t v = 0; v < comp_id.size(); ++v) {
+        int& id = id_of[comp_id[v]];
+        if (id == -1) id = count++;
+        result[v] = id;
+    }
+    return result;
+}
+
+void test_parallel_scc_matches_sequential() {
+    std::vector<EdgeList> inputs = {
+        random_graph(3000, 2500, 3),
+        random_graph(3000, 9000, 5),
+        random_dag(2000, 6000, 7),
+        chain_graph(5000),
+    };
+    // гигантская компонента с хвостами и петлями
+    EdgeList giant = random_graph(4000, 16000, 11);
+    for (int v = 0; v < 500; ++v) {
+        giant.add(v, v);
+        giant.add(v, v + 1);
+    }
+    inputs.push_back(giant);
+    EdgeList cycle = chain_graph(5000);
+    cycle.add(4999, 0);
+    inputs.push_back(cycle);
+    
+    for (const EdgeList& edges : inputs) {
+        CSRGraph graph = CSRGraph::from_edges(edges, true);
+        std::vector<int> expected(edges.n);
+        int count = strongly_connected_components(graph, expected);
+        expected = canonical(expected);
+        for (unsigned threads : {1u, 2u, 4u}) {
+            std::vector<int> comp_id(edges.n);
+            SolverStats stats("test");
+            assert(strongly_connected_components_parallel(graph, comp_id, threads, stats) == count);
+            assert(comp_id == expected);
+        }
+    }
+    
+    // выше порогов на поток — параллельное транспонирование и путь через Graph
+    EdgeList edges = random_graph(100000, 400000, 13);
+    CSRGraph graph = CSRGraph::from_edges(edges, true);
+    CSRGraph reverse = graph.transpose();
+    CSRGraph reverse_parallel = graph.transpose(4);
+    assert(std::ranges::equal(reverse.offsets(), reverse_parallel.offsets()));
+    assert(std::ranges::equal(reverse.targets(), reverse_parallel.targets()));
+    // параллельная раскладка с весами и номерами рёбер — тот же порядок соседей
+    EdgeList weighted = edges;
+    assign_random_weights(weighted, -50, 50, 17);
+    for (bool directed : {true, false}) {
+        CSRGraph one = CSRGraph::from_edges(weighted, directed, true);
+        CSRGraph many = CSRGraph::from_edges(weighted, directed, true, 4);
+        for (auto [a, b] : {std::pair{one, many}, std::pair{one.transpose(), many.transpose(4)}}) {
+            assert(std::ranges::equal(a.offsets(), b.offsets()));
+            assert(std::ranges::equal(a.targets(), b.targets()));
+            assert(std::ranges::equal(a.weights(), b.weights()));
+            assert(std::ranges::equal(a.edge_ids(), b.edge_ids()));
+        }
+    }
+    Graph g(graph);
+    assert(g.min_edges_to_make_strongly_connected_parallel(3) == g.min_edges_to_make_strongly_connected());
+    std::cout << "test_parallel_scc_matches_sequential: OK" << std::endl;
+}
+
+void test_condensation_augmentation() {
+    std::vector<EdgeList> inputs;
+    for (int seed = 1; seed <= 60; ++seed) {
+        int n = 1 + seed % 30;
+        inputs.push_back(seed % 2 ? random_graph(n, n + seed % 17, seed) : random_dag(n, n + seed % 11, seed));
+    }
+    // кратные дуги между компонентами и изолированные вершины
+    EdgeList multi(6);
+    for (int k = 0; k < 3; ++k) {
+        multi.add(0, 1);
+        multi.add(1, 0);
+        multi.add(1, 2);
+    }
+    multi.add(3, 3);
+    inputs.push_back(multi);
+    inputs.push_back(EdgeList(4));
+    
+    for (const EdgeList& edges : inputs) {
+        Graph g(edges.n);
+        for (int i = 0; i < edges.size(); ++i) {
+            g.add_edge(edges.from[i], edges.to[i]);
+        }
+        Condensation condensation = g.condensation();
+        int count = condensation.component_count();
+        const CSRGraph& dag = condensation.dag();
+        
+        // DAG без повторов и петель, каждая дуга исходного графа в нём есть
+        for (int c = 0; c < count; ++c) {
+            auto neighbors = dag.neighbors(c);
+            assert(std::ranges::adjacent_find(neighbors, std::greater_equal<>()) == neighbors.end());
+            assert(condensation.component(condensation.representative(c)) == c);
+        }
+        for (int i = 0; i < edges.size(); ++i) {
+            int c = condensation.component(edges.from[i]);
+            int d = condensation.component(edges.to[i]);
+            assert(c == d || std::ranges::binary_search(dag.neighbors(c), d));
+        }
+        std::vector<int> dag_comp(count);
+        assert(strongly_connected_components(dag, dag_comp) == count);
+        
+        // добавленные дуги делают граф сильно связным, и их ровно столько
+        EdgeList extra = condensation.augmentation();
+        assert(extra.size() == condensation.augmentation_size());
+        assert(extra.size() == g.min_edges_to_make_strongly_connected());
+        for (int i = 0; i < extra.size(); ++i) {
+            g.add_edge(extra.from[i], extra.to[i]);
+        }
+        assert(g.min_edges_to_make_strongly_connected() == 0);
+    }
+    std::cout << "test_condensation_augmentation: OK" << std::endl;
+}
+
+void test_incremental_scc() {
+    for (int seed = 1; seed <= 30; ++seed) {
+        int n = 2 + seed % 25;
+        EdgeList edges = seed % 3 ? random_graph(n, 3 * n, seed) : random_dag(n, 2 * n, seed);
+        // дуги в обратную сторону замыкают циклы через уже склеенные компоненты
+        for (int i = edges.size() - 1; i >= 0 && i >= edges.size() - n / 2; --i) {
+            edges.add(edges.to[i], edges.from[i]);
+        }
+        IncrementalSCC incremental(n);
+        EdgeList prefix(n);
+        for (int i = 0; i < edges.size(); ++i) {
+            incremental.add_edge(edges.from[i], edges.to[i]);
+            prefix.add(edges.from[i], edges.to[i]);
+            
+            CSRGraph graph = CSRGraph::from_edges(prefix, true);
+            std::vector<int> comp_id(n);
+            int count = strongly_connected_components(graph, comp_id);
+            Condensation condensation(graph, comp_id, count);
+            assert(incremental.component_count() == count);
+            assert(incremental.source_count() == static_cast<int>(condensation.sources().size()));
+            assert(incremental.sink_count() == static_cast<int>(condensation.sinks().size()));
+            assert(incremental.augmentation_size() == condensation.augmentation_size());
+            for (int u = 0; u < n; ++u) {
+                assert(incremental.strongly_connected(u, condensation.representative(comp_id[u])));
+                assert(incremental.component(u) == incremental.component(condensation.representative(comp_id[u])));
+            }
+        }
+    }
+    
+    // режим Graph: ответ после каждой дуги без пересчёта
+    Graph g(5);
+    g.add_edge(0, 1);
+    g.track_incrementally();
+    g.add_edge(2, 1);
+    assert(g.min_edges_to_make_strongly_connected() == 4);
+    g.add_edge(1, 3);
+    g.add_edge(1, 4);
+    assert(g.min_edges_to_make_strongly_connected() == 2);
+    g.add_edge(3, 0);
+    g.add_edge(4, 2);
+    assert(g.min_edges_to_make_strongly_connected() == 0);
+    std::cout << "test_incremental_scc: OK" << std::endl;
+}
+
+void test_reachability_index() {
+    for (int seed = 1; seed <= 40; ++seed) {
+        int n = 1 + seed % 35;
+        EdgeList edges = seed % 2 ? random_graph(n, n + seed % 19, seed) : random_dag(n, 2 * n, seed);
+        std::vector<std::vector<char>> reach = brute_reachability(edges);
+        Graph g(edges.n);
+        for (int i = 0; i < edges.size(); ++i) {
+            g.add_edge(edges.from[i], edges.to[i]);
+        }
+        Condensation condensation = g.condensation();
+        // битовые строки и 2-hop метки (таблица не влезает в 0 байт)
+        ReachabilityIndex bitsets(condensation);
+        ReachabilityIndex labels(condensation, 0);
+        assert(bitsets.uses_bitsets() && !labels.uses_bitsets());
+        for (int a = 0; a < n; ++a) {
+            for (int b = 0; b < n; ++b) {
+                assert(bitsets.reachable(a, b) == static_cast<bool>(reach[a][b]));
+                assert(labels.reachable(a, b) == static_cast<bool>(reach[a][b]));
+            }
+        }
+    }
+    
+    // пакет на нескольких потоках совпадает с одиночными запросами
+    EdgeList edges = random_graph(2000, 2600, 17);
+    Graph g(edges.n);
+    for (int i = 0; i < edges.size(); ++i) {
+        g.add_edge(edges.from[i], edges.to[i]);
+    }
+    ReachabilityIndex index = g.build_reachability_index();
+    ReachabilityIndex labels(g.condensation(), 0);
+    EdgeList queries = random_graph(2000, 100000, 5);
+    std::vector<uint8_t> answers = index.reachable(queries, 4);
+    assert(answers == labels.reachable(queries, 1));
+    for (int i = 0; i < queries.size(); ++i) {
+        assert(answers[i] == index.reachable(queries.from[i], queries.to[i]));
+    }
+    std::cout << "test_reachability_index: OK" << std::endl;
+}
+
 int main() {
     test_example1();
     test_example2();
@@ -109,6 +389,13 @@ int main() {
     test_no_edges();
     test_chain();
     test_diamond();
+    test_from_csr();
+    test_scc_random();
+    test_scc_deep();
+    test_parallel_scc_matches_sequential();
+    test_condensation_augmentation();
+    test_incremental_scc();
+    test_reachability_index();
     
     std::cout << "All tests passed!" << std::endl;
     return 0;
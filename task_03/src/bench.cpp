@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include "bench_alloc.hpp"
+#include "topology_sort.h"
+#include "graph_generators.hpp"
+
+enum Family { kDag, kChain, kSparse };
+
+static const char* family_name(int family) {
+    static const char* names[] = {"dag", "chain", "sparse_dag"};
+    return names[family];
+}
+
+static EdgeList make_graph(int family, int n) {
+    switch (family) {
+        case kDag:
+            return random_dag(n, 4LL * n, 42);
+        case kChain:
+            return chain_graph(n);
+        default:
+            return random_dag(n, n / 2, 42);
+    }
+}
+
+static void BM_TopologicalSort(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    TopologySorter sorter(CSRGraph::from_edges(edges, true));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(sorter.topological_sort());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+// range(2) — число потоков, 0 — все ядра
+static void BM_TopologicalLevels(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    TopologySorter sorter(CSRGraph::from_edges(edges, true));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sorter.topological_levels(state.range(2)));
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+BENCHMARK(BM_TopologicalSort)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kDag, kChain, kSparse}});
+BENCHMARK(BM_TopologicalLevels)
+    ->ArgsProduct({{1 << 16, 1 << 20}, {kDag, kChain, kSparse}, {1, 0}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
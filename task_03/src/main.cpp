@@ -1,29 +1,37 @@
-#include <iostream>
 #include "topology_sort.h"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "graph_file.hpp"
+#include "driver_args.hpp"
 
-int main() {
-    int n, m;
-    std::cin >> n >> m;
+CSRGraph read_graph(unsigned threads) {
+    FastReader in;
+    int n = in.read_int();
+    int m = in.read_int();
     
-    TopologySorter sorter(n);
-    
-    for (int i = 0; i < m; ++i) {
-        int u, v;
-        std::cin >> u >> v;
-        sorter.add_edge(u - 1, v - 1);
-    }
+    EdgeList edges = read_edge_list(in, n, m, false, threads);
+    return CSRGraph::from_edges(edges, true, false, threads);
+}
+
+int main(int argc, char* argv[]) {
+    FastWriter out;
+    // --graph <file>: граф из бинарного файла (tools/graph_convert), без разбора текста
+    DriverArgs args(argc, argv);
+    TopologySorter sorter(args.graph_path ? load_graph_file(args.graph_path, true, false) : read_graph(args.threads));
     
     std::vector<int> result = sorter.topological_sort();
     
     if (result.empty()) {
-        std::cout << -1 << std::endl;
+        out << -1 << '\n';
     } else {
         for (size_t i = 0; i < result.size(); ++i) {
-            if (i > 0) std::cout << " ";
-            std::cout << result[i] + 1;
+            if (i > 0) out << " ";
+            out << result[i] + 1;
         }
-        std::cout << std::endl;
+        out << '\n';
     }
     
+    args.dump_stats(sorter.get_stats());
     return 0;
 }
\ No newline at end of file
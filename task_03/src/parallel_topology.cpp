@@ -0,0 +1,97 @@
+#include "parallel_topology.h"
+#include <algorithm>
+#include <atomic>
+#include "parallel.hpp"
+
+namespace {
+
+// Меньшая волна обходится в вызывающем потоке: на глубоких DAG запуск
+// потоков на каждой волне дороже самой волны.
+constexpr size_t kMinFrontierPerThread = 1 << 12;
+
+}  // namespace
+
+bool topological_levels_parallel(const CSRGraph& graph, unsigned threads, TopologicalLevels& levels,
+                                 [[maybe_unused]] SolverStats& stats) {
+    int n = graph.vertex_count();
+    auto offsets = graph.offsets();
+    auto targets = graph.targets();
+    threads = std::max(threads, 1u);
+    STATS_CLOCK(stats);
+
+    std::vector<int> in_degree(n, 0);
+    parallel_vertex_blocks(offsets, threads, [&](unsigned, int begin, int end) {
+        for (size_t i = offsets[begin]; i < offsets[end]; ++i) {
+            if (threads == 1) {
+                ++in_degree[targets[i]];
+            } else {
+                std::atomic_ref<int>(in_degree[targets[i]]).fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+    // истоки по кускам вершин — первая волна по возрастанию номеров
+    std::vector<std::vector<int>> next(threads);
+    parallel_blocks(n, threads, [&](unsigned part, size_t begin, size_t end) {
+        for (size_t v = begin; v < end; ++v) {
+            if (in_degree[v] == 0) next[part].push_back(static_cast<int>(v));
+        }
+    });
+    STATS_LAP("in_degree");
+
+    levels.offsets.assign(1, 0);
+    levels.order.clear();
+    // места хватает на все вершины: чтение волны не переживает перевыделений
+    levels.order.reserve(n);
+    auto flush = [&] {
+        for (std::vector<int>& part : next) {
+            levels.order.insert(levels.order.end(), part.begin(), part.end());
+            part.clear();
+        }
+    };
+    flush();
+
+    size_t begin = 0;
+    while (begin < levels.order.size()) {
+        size_t end = levels.order.size();
+        levels.offsets.push_back(static_cast<int>(end));
+        unsigned parts = std::clamp<size_t>((end - begin) / kMinFrontierPerThread, 1, threads);
+        if (parts == 1) {
+            // одна часть: следующая волна пишется сразу в order
+            for (size_t i = begin; i < end; ++i) {
+                int v = levels.order[i];
+                for (size_t j = offsets[v]; j < offsets[v + 1]; ++j) {
+                    int w = targets[j];
+                    if (threads == 1 ? --in_degree[w] == 0
+                                     : std::atomic_ref<int>(in_degree[w]).fetch_sub(1, std::memory_order_relaxed) == 1) {
+                        levels.order.push_back(w);
+                    }
+                }
+            }
+        } else {
+            parallel_blocks(end - begin, parts, [&](unsigned part, size_t lo, size_t hi) {
+                for (size_t i = begin + lo; i < begin + hi; ++i) {
+                    int v = levels.order[i];
+                    for (size_t j = offsets[v]; j < offsets[v + 1]; ++j) {
+                        int w = targets[j];
+                        if (std::atomic_ref<int>(in_degree[w]).fetch_sub(1, std::memory_order_relaxed) == 1) {
+                            next[part].push_back(w);
+                        }
+                    }
+                }
+            });
+            flush();
+        }
+        begin = end;
+    }
+    STATS_LAP("waves");
+    STATS_ADD(stats, "levels", levels.level_count());
+    STATS_ADD(stats, "arcs_scanned", graph.arc_count());
+
+    if (static_cast<int>(levels.order.size()) < n) {
+        // вершины цикла так и не получили нулевую входящую степень
+        levels.offsets.assign(1, 0);
+        levels.order.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+#ifndef PARALLEL_TOPOLOGY_H
+#define PARALLEL_TOPOLOGY_H
+
+#include <span>
+#include <vector>
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
+
+// Волны топологического порядка в формате CSR: волна k — вершины, самый
+// длинный путь до которых из истока состоит из k дуг. order — все вершины
+// подряд по волнам, это тоже топологический порядок.
+struct TopologicalLevels {
+    std::vector<int> offsets{0};
+    std::vector<int> order;
+
+    int level_count() const { return static_cast<int>(offsets.size()) - 1; }
+    std::span<const int> level(int k) const {
+        return std::span<const int>(order).subspan(offsets[k], offsets[k + 1] - offsets[k]);
+    }
+};
+
+// Алгоритм Кана по волнам на threads потоках: входящие степени считаются и
+// уменьшаются атомарно, вершина попадает в следующую волну у того потока,
+// который снял её последнюю входящую дугу. Волны меньше порога обходятся в
+// вызывающем потоке. Состав волн от числа потоков не зависит, порядок
+// вершин внутри волны при threads > 1 — зависит. Возвращает false (и пустые
+// волны), если в графе есть цикл.
+bool topological_levels_parallel(const CSRGraph& graph, unsigned threads, TopologicalLevels& levels,
+                                 SolverStats& stats);
+
+#endif
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <cassert>
+#include <algorithm>
 #include <vector>
+#include "graph_generators.hpp"
 #include "topology_sort.h"
 
 void test_simple_dag() {
@@ -154,6 +156,104 @@ void test_mixed_edges() {
     std::cout << "test_mixed_edges: OK" << std::endl;
 }
 
+void test_from_csr() {
+    EdgeList edges(3);
+    edges.add(2, 1);
+    edges.add(1, 0);
+    TopologySorter sorter(CSRGraph::from_edges(edges, true));
+    
+    assert(sorter.topological_sort() == std::vector<int>({2, 1, 0}));
+    sorter.add_edge(0, 2);
+    assert(sorter.topological_sort().empty());
+    assert(sorter.hasCycle());
+    
+    std::cout << "test_from_csr: OK" << std::endl;
+}
+
+void test_deep_chain() {
+    // глубина обхода 2 * 10^5 — предел из условия
+    const int n = 200000;
+    TopologySorter sorter(n);
+    for (int i = n - 1; i > 0; --i) {
+        sorter.add_edge(i - 1, i);
+    }
+    
+    std::vector<int> result = sorter.topological_sort();
+    assert(result.size() == n);
+    assert(result.front() == 0 && result.back() == n - 1);
+    
+    sorter.add_edge(n - 1, 0);
+    assert(sorter.topological_sort().empty());
+    assert(sorter.hasCycle());
+    
+    std::cout << "test_deep_chain: OK" << std::endl;
+}
+
+// волна каждой вершины — длина самого длинного пути до неё
+void check_levels(const CSRGraph& graph, const TopologicalLevels& levels) {
+    int n = graph.vertex_count();
+    assert(static_cast<int>(levels.order.size()) == n);
+    std::vector<int> wave(n, -1);
+    for (int k = 0; k < levels.level_count(); ++k) {
+        assert(!levels.level(k).empty());
+        for (int v : levels.level(k)) {
+            assert(wave[v] == -1);
+            wave[v] = k;
+        }
+    }
+    std::vector<int> depth(n, 0);
+    for (int v : levels.order) {
+        for (int u : graph.neighbors(v)) {
+            assert(wave[u] > wave[v]);
+            depth[u] = std::max(depth[u], depth[v] + 1);
+        }
+    }
+    for (int v = 0; v < n; ++v) {
+        assert(wave[v] == depth[v]);
+    }
+}
+
+void test_topological_levels() {
+    TopologySorter sorter(5);
+    sorter.add_edge(0, 1);
+    sorter.add_edge(0, 2);
+    sorter.add_edge(1, 3);
+    sorter.add_edge(2, 3);
+    sorter.add_edge(0, 3);
+    
+    TopologicalLevels levels = sorter.topological_levels(4);
+    assert(!sorter.hasCycle());
+    assert(levels.offsets == std::vector<int>({0, 2, 4, 5}));
+    assert(levels.order == std::vector<int>({0, 4, 1, 2, 3}));
+    
+    sorter.add_edge(3, 0);
+    levels = sorter.topological_levels();
+    assert(sorter.hasCycle());
+    assert(levels.level_count() == 0 && levels.order.empty());
+    
+    TopologySorter empty(0);
+    assert(empty.topological_levels().level_count() == 0);
+    assert(!empty.hasCycle());
+    
+    // широкие волны делятся между потоками
+    CSRGraph graph = CSRGraph::from_edges(random_dag(200000, 600000, 7), true);
+    for (unsigned threads : {1u, 4u}) {
+        SolverStats stats("levels");
+        TopologicalLevels parallel;
+        assert(topological_levels_parallel(graph, threads, parallel, stats));
+        check_levels(graph, parallel);
+    }
+    
+    EdgeList cyclic = random_dag(50000, 150000, 8);
+    cyclic.add(cyclic.to[0], cyclic.from[0]);
+    SolverStats stats("levels");
+    TopologicalLevels none;
+    assert(!topological_levels_parallel(CSRGraph::from_edges(cyclic, true), 4, none, stats));
+    assert(none.order.empty());
+    
+    std::cout << "test_topological_levels: OK" << std::endl;
+}
+
 int main() {
     test_simple_dag();
     test_cycle();
@@ -165,6 +265,9 @@ int main() {
     test_complex_dag();
     test_complex_cycle();
     test_mixed_edges();
+    test_from_csr();
+    test_deep_chain();
+    test_topological_levels();
     
     return 0;
 }
\ No newline at end of file
@@ -1,46 +1,68 @@
 #include "topology_sort.h"
 #include <algorithm>
+#include "parallel.hpp"
 
-TopologySorter::TopologySorter(int vertices) : n(vertices), has_cycle(false) {
-    adj.resize(n);
-    color.resize(n, 0);
+namespace {
+
+// Меньше дуг на поток — потоки дороже самого обхода.
+constexpr int kMinArcsPerThread = 1 << 17;
+
+}  // namespace
+
+TopologySorter::TopologySorter(int vertices) : n(vertices), edges(vertices), adj_dirty(true), has_cycle(false) {
 }
 
-void TopologySorter::add_edge(int from, int to) {
-    adj[from].push_back(to);
+TopologySorter::TopologySorter(const CSRGraph& graph)
+    : n(graph.vertex_count()), edges(graph.vertex_count()), adj(graph), adj_dirty(false), has_cycle(false) {
 }
 
-bool TopologySorter::dfs(int v) {
-    color[v] = 1;
-    
-    for (int u : adj[v]) {
-        if (color[u] == 0) {
-            if (dfs(u)) {
-                return true;
-            }
-        } else if (color[u] == 1) {
-            has_cycle = true;
-            return true;//нашл цикл
-        }
+void TopologySorter::add_edge(int from, int to) {
+    if (edges.empty() && adj.arc_count() > 0) {
+        // граф был передан готовым CSR: восстанавливаем список рёбер
+        edges = adj.to_edge_list();
     }
-    
-    color[v] = 2; //чернный обработан
-    order.push_back(v);
-    return false;
+    edges.add(from, to);
+    adj_dirty = true;
+}
+
+void TopologySorter::build_adjacency() {
+    if (!adj_dirty) return;
+    STATS_PHASE(stats, "build_adjacency");
+    adj = CSRGraph::from_edges(edges, true);
+    adj_dirty = false;
 }
 
 std::vector<int> TopologySorter::topological_sort() {
+    build_adjacency();
+    STATS_PHASE(stats, "dfs");
     order.clear();
     has_cycle = false;
-    std::fill(color.begin(), color.end(), 0);
-    
+    dfs.reset(n);
+
+    struct Visitor : DfsVisitor {
+        TopologySorter& s;
+        STATS_ONLY(uint64_t arcs = 0;)
+        explicit Visitor(TopologySorter& sorter) : s(sorter) {}
+        void tree_edge(int, int) { STATS_ONLY(++arcs;) }
+        void non_tree_edge(int, int, bool on_stack) {
+            STATS_ONLY(++arcs;)
+            if (on_stack) s.has_cycle = true; //нашл цикл
+        }
+        void leave(int v, int) { s.order.push_back(v); }
+        bool stop() const { return s.has_cycle; }
+    };
+
+    Visitor visitor(*this);
     for (int i = 0; i < n; ++i) {
-        if (color[i] == 0) {
-            if (dfs(i)) {
+        if (!dfs.visited(i)) {
+            if (!dfs.run(adj, i, visitor)) {
                 break;
             }
         }
     }
+    STATS_ADD(stats, "arcs_scanned", visitor.arcs);
+    STATS_ADD(stats, "vertices_finished", order.size());
+    STATS_ADD(stats, "cycles_found", has_cycle);
     
     if (has_cycle) {
         return std::vector<int>();
@@ -50,6 +72,18 @@ std::vector<int> TopologySorter::topological_sort() {
     return order;
 }
 
+TopologicalLevels TopologySorter::topological_levels(unsigned threads) {
+    build_adjacency();
+    if (threads == 0) threads = default_thread_count();
+    threads = std::max(1u, std::min<unsigned>(threads, adj.arc_count() / kMinArcsPerThread));
+    STATS_PHASE(stats, "levels");
+    STATS_ADD(stats, "threads", threads);
+    TopologicalLevels levels;
+    has_cycle = !topological_levels_parallel(adj, threads, levels, stats);
+    STATS_ADD(stats, "cycles_found", has_cycle);
+    return levels;
+}
+
 bool TopologySorter::hasCycle() const {
     return has_cycle;
 }
\ No newline at end of file
@@ -2,22 +2,35 @@
 #define TOPOLOGY_SORT_H
 
 #include <vector>
+#include "csr_graph.hpp"
+#include "dfs.hpp"
+#include "parallel_topology.h"
+#include "solver_stats.hpp"
 
 class TopologySorter {
 private:
     int n;
-    std::vector<std::vector<int>> adj;
-    std::vector<int> color; // 0 - белый, 1 - серый, 2 - черный
+    EdgeList edges;
+    CSRGraph adj;
+    bool adj_dirty;
+    DfsEngine dfs; // серые вершины — на стеке обхода, черные обработаны
     std::vector<int> order;
     bool has_cycle;
+    SolverStats stats{"topological_sort"};
     
-    bool dfs(int v);
+    void build_adjacency();
     
 public:
     TopologySorter(int vertices);
+    TopologySorter(const CSRGraph& graph);
     void add_edge(int from, int to);
     std::vector<int> topological_sort();
+    // Волны по длине самого длинного пути из истока и порядок по волнам
+    // (см. topological_levels_parallel), threads — 0 значит все ядра. При
+    // цикле волны пусты и hasCycle() == true.
+    TopologicalLevels topological_levels(unsigned threads = 0);
     bool hasCycle() const;
+    SolverStats get_stats() const { return stats; }
 };
 
 #endif
\ No newline at end of file
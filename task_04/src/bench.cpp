@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include "bench_alloc.hpp"
+#include "johnson.h"
+#include "graph_generators.hpp"
+
+enum Family { kRandom, kNegativeDag, kGrid };
+
+static const char* family_name(int family) {
+    static const char* names[] = {"random", "negative_dag", "grid"};
+    return names[family];
+}
+
+static EdgeList make_graph(int family, int n) {
+    EdgeList edges;
+    switch (family) {
+        case kRandom:
+            edges = random_graph(n, 4LL * n, 42);
+            assign_random_weights(edges, 1, 1000, 7);
+            break;
+        case kNegativeDag:
+            edges = random_dag(n, 4LL * n, 42);
+            assign_random_weights(edges, -1000, 1000, 7);
+            break;
+        default: {
+            int side = std::sqrt(n);
+            edges = grid_graph(side, side);
+            assign_random_weights(edges, 1, 1000, 7);
+            break;
+        }
+    }
+    return edges;
+}
+
+static void BM_JohnsonSolve(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    JohnsonSolver solver(WideCSRGraph::from_edges(edges, true));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(solver.solve());
+        }
+    }
+    // n запусков Дейкстры по всем рёбрам
+    state.SetItemsProcessed(state.iterations() * edges.n * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_JohnsonSolveArena(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    Arena arena;
+    JohnsonSolver solver(WideCSRGraph::from_edges(edges, true), &arena);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(solver.solve());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * edges.n * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+BENCHMARK(BM_JohnsonSolve)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 10, 2), {kRandom, kNegativeDag, kGrid}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_JohnsonSolveArena)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 10, 2), {kRandom, kNegativeDag, kGrid}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
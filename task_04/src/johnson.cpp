@@ -3,17 +3,35 @@
 #include <vector>
 #include <algorithm>
 
-JohnsonSolver::JohnsonSolver(int vertices) : n(vertices) {
-    adj.resize(n);
+JohnsonSolver::JohnsonSolver(int vertices, Arena* scratch)
+    : n(vertices), edges(vertices), adj_dirty(true), scratch(scratch) {
+}
+
+JohnsonSolver::JohnsonSolver(const WideCSRGraph& graph, Arena* scratch)
+    : n(graph.vertex_count()), edges(graph.vertex_count()), adj(graph), adj_dirty(false), scratch(scratch) {
 }
 
 void JohnsonSolver::add_edge(int u, int v, long long w) {
-    adj[u].emplace_back(v, w);
+    if (edges.empty() && adj.arc_count() > 0) {
+        // граф был передан готовым CSR: восстанавливаем список рёбер
+        edges = adj.to_edge_list();
+    }
+    edges.add(u, v, w);
+    adj_dirty = true;
+}
+
+void JohnsonSolver::build_adjacency() {
+    if (!adj_dirty) return;
+    STATS_PHASE(stats, "build_adjacency");
+    adj = WideCSRGraph::from_edges(edges, true);
+    adj_dirty = false;
 }
 
-bool JohnsonSolver::bellman_ford(std::vector<long long>& h) {
+bool JohnsonSolver::bellman_ford(std::pmr::vector<long long>& h) {
+    STATS_PHASE(stats, "bellman_ford");
     h.assign(n + 1, INF);
     h[n] = 0;
+    STATS_ONLY(uint64_t relaxations = 0;)
     
     for (int i = 0; i < n; ++i) {
         for (int u = 0; u <= n; ++u) {
@@ -26,16 +44,21 @@ bool JohnsonSolver::bellman_ford(std::vector<long long>& h) {
                     }
                 }
             } else {
-                for (const auto& edge : adj[u]) {
-                    int v = edge.first;
-                    long long w = edge.second;
+                auto targets = adj.neighbors(u);
+                auto weights = adj.neighbor_weights(u);
+                for (size_t i = 0; i < targets.size(); ++i) {
+                    int v = targets[i];
+                    long long w = weights[i];
                     if (h[v] > h[u] + w) {
                         h[v] = h[u] + w;
+                        STATS_ONLY(++relaxations;)
                     }
                 }
             }
         }
     }
+    STATS_ADD(stats, "bellman_ford_rounds", n);
+    STATS_ADD(stats, "bellman_ford_relaxations", relaxations);
     
     for (int u = 0; u <= n; ++u) {
         if (h[u] == INF) continue;
@@ -45,9 +68,11 @@ bool JohnsonSolver::bellman_ford(std::vector<long long>& h) {
                 if (h[v] > h[u]) return false;
             }
         } else {
-            for (const auto& edge : adj[u]) {
-                int v = edge.first;
-                long long w = edge.second;
+            auto targets = adj.neighbors(u);
+            auto weights = adj.neighbor_weights(u);
+            for (size_t i = 0; i < targets.size(); ++i) {
+                int v = targets[i];
+                long long w = weights[i];
                 if (h[v] > h[u] + w) {
                     return false;
                 }
@@ -59,50 +84,64 @@ bool JohnsonSolver::bellman_ford(std::vector<long long>& h) {
     return true;
 }
 
-std::vector<long long> JohnsonSolver::dijkstra(int start, const std::vector<long long>& h) {
-    std::vector<long long> dist(n, INF);
+void JohnsonSolver::dijkstra(int start, const std::pmr::vector<long long>& h, std::vector<long long>& dist,
+                             Heap& pq) {
+    dist.assign(n, INF);
     dist[start] = 0;
-    
-    std::priority_queue<std::pair<long long, int>, 
-                       std::vector<std::pair<long long, int>>,
-                       std::greater<std::pair<long long, int>>> pq;
     pq.emplace(0, start);
+    STATS_ONLY(uint64_t pushes = 1; uint64_t pops = 0; uint64_t stale = 0; uint64_t scanned = 0;)
     
     while (!pq.empty()) {
         auto [d, u] = pq.top();
         pq.pop();
+        STATS_ONLY(++pops;)
         
-        if (d != dist[u]) continue;
+        if (d != dist[u]) {
+            STATS_ONLY(++stale;)
+            continue;
+        }
+        STATS_ONLY(scanned += adj.degree(u);)
         
-        for (const auto& edge : adj[u]) {
-            int v = edge.first;
-            long long w = edge.second + h[u] - h[v];
+        auto targets = adj.neighbors(u);
+        auto weights = adj.neighbor_weights(u);
+        for (size_t i = 0; i < targets.size(); ++i) {
+            int v = targets[i];
+            long long w = weights[i] + h[u] - h[v];
             
             if (dist[v] > dist[u] + w) {
                 dist[v] = dist[u] + w;
                 pq.emplace(dist[v], v);
+                STATS_ONLY(++pushes;)
             }
         }
     }
+    STATS_ADD(stats, "heap_pushes", pushes);
+    STATS_ADD(stats, "heap_pops", pops);
+    STATS_ADD(stats, "stale_pops", stale);
+    STATS_ADD(stats, "arcs_scanned", scanned);
     
     for (int v = 0; v < n; ++v) {
         if (dist[v] != INF) {
             dist[v] = dist[v] - h[start] + h[v];
         }
     }
-    
-    return dist;
 }
 
 std::vector<std::vector<long long>> JohnsonSolver::solve() {
-    std::vector<long long> h;
+    build_adjacency();
+    ScratchScope scope(scratch);
+    std::pmr::vector<long long> h(scope.resource());
     if (!bellman_ford(h)) {
         return {};
     }
     
     std::vector<std::vector<long long>> distances(n);
+    Heap pq(std::greater<std::pair<long long, int>>(),
+            std::pmr::vector<std::pair<long long, int>>(scope.resource()));
+    STATS_PHASE(stats, "dijkstra");
+    STATS_ADD(stats, "dijkstra_runs", n);
     for (int i = 0; i < n; ++i) {
-        distances[i] = dijkstra(i, h);
+        dijkstra(i, h, distances[i], pq);
     }
     
     return distances;
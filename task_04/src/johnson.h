@@ -3,20 +3,38 @@
 
 #include <vector>
 #include <limits>
+#include <memory_resource>
+#include <queue>
+#include "arena.hpp"
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
 
 class JohnsonSolver {
 private:
     const long long INF = std::numeric_limits<long long>::max() / 2;
     int n;
-    std::vector<std::vector<std::pair<int, long long>>> adj;
+    EdgeList edges;
+    WideCSRGraph adj;
+    bool adj_dirty;
+    Arena* scratch;
+    SolverStats stats{"johnson"};
     
-    bool bellman_ford(std::vector<long long>& h);
-    std::vector<long long> dijkstra(int start, const std::vector<long long>& h);
+    using Heap = std::priority_queue<std::pair<long long, int>,
+                                     std::pmr::vector<std::pair<long long, int>>,
+                                     std::greater<std::pair<long long, int>>>;
+    
+    void build_adjacency();
+    bool bellman_ford(std::pmr::vector<long long>& h);
+    // dist — строка ответа, pq — общая для всех источников куча
+    void dijkstra(int start, const std::pmr::vector<long long>& h, std::vector<long long>& dist, Heap& pq);
     
 public:
-    JohnsonSolver(int vertices);
+    // scratch — арена для временных буферов; nullptr — обычная куча
+    JohnsonSolver(int vertices, Arena* scratch = nullptr);
+    JohnsonSolver(const WideCSRGraph& graph, Arena* scratch = nullptr);
     void add_edge(int u, int v, long long w);
     std::vector<std::vector<long long>> solve();
+    SolverStats get_stats() const { return stats; }
 };
 
 #endif
\ No newline at end of file
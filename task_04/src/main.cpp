@@ -1,24 +1,34 @@
-#include <iostream>
 #include <vector>
 #include "johnson.h"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "graph_file.hpp"
+#include "driver_args.hpp"
 
-int main() {
-    int n, m;
-    std::cin >> n >> m;
+WideCSRGraph read_graph(unsigned threads) {
+    FastReader in;
+    int n = in.read_int();
+    int m = in.read_int();
     
-    JohnsonSolver solver(n);
+    EdgeList edges = read_edge_list(in, n, m, true, threads);
+    return WideCSRGraph::from_edges(edges, true, false, threads);
+}
+
+int main(int argc, char* argv[]) {
+    FastWriter out;
+    // --graph <file>: граф из бинарного файла (tools/graph_convert), без разбора текста
+    DriverArgs args(argc, argv);
+    WideCSRGraph graph = args.graph_path ? load_graph_file<int64_t>(args.graph_path, true, true) : read_graph(args.threads);
+    int n = graph.vertex_count();
     
-    for (int i = 0; i < m; ++i) {
-        int u, v;
-        long long w;
-        std::cin >> u >> v >> w;
-        solver.add_edge(u - 1, v - 1, w);
-    }
+    JohnsonSolver solver(graph);
     
     std::vector<std::vector<long long>> result = solver.solve();
     
     if (result.empty()) {
-        std::cout << -1 << std::endl;
+        out << -1 << '\n';
+        args.dump_stats(solver.get_stats());
         return 0;
     }
     
@@ -27,17 +37,18 @@ int main() {
     for (int i = 0; i < n; ++i) {
         for (int j = 0; j < n; ++j) {
             if (result[i][j] == INF) {
-                std::cout << "INF";
+                out << "INF";
             } else {
-                std::cout << result[i][j];
+                out << result[i][j];
             }
             
             if (j < n - 1) {
-                std::cout << " ";
+                out << " ";
             }
         }
-        std::cout << std::endl;
+        out << '\n';
     }
     
+    args.dump_stats(solver.get_stats());
     return 0;
 }
\ No newline at end of file
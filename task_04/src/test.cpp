@@ -1,7 +1,11 @@
 #include <iostream>
 #include <vector>
 #include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
 #include "johnson.h"
+#include "graph_file.hpp"
 
 void test_simple_graph() {
     JohnsonSolver solver(4);
@@ -42,13 +46,16 @@ void test_negative_weights() {
 
 void test_no_negative_cycle() {
     JohnsonSolver solver(4);
-    solver.add_edge(0, 1, 1);
+    // цикл нулевого веса — не отрицательный
+    solver.add_edge(0, 1, 3);
     solver.add_edge(1, 2, -1);
     solver.add_edge(2, 3, -1);
     solver.add_edge(3, 0, -1);
     
     std::vector<std::vector<long long>> result = solver.solve();
     assert(!result.empty());
+    assert(result[0][0] == 0);
+    assert(result[1][0] == -3);
     
     std::cout << "test_no_negative_cycle: OK" << std::endl;
 }
@@ -99,7 +106,8 @@ void test_large_weights() {
     std::vector<std::vector<long long>> result = solver.solve();
     assert(!result.empty());
     
-    assert(result[0][2] == 500000000);
+    // путь 0 -> 1 -> 2 короче прямого ребра
+    assert(result[0][2] == 0);
     
     std::cout << "test_large_weights: OK" << std::endl;
 }
@@ -158,6 +166,140 @@ void test_chain_graph() {
     std::cout << "test_chain_graph: OK" << std::endl;
 }
 
+void test_from_csr() {
+    EdgeList edges(3);
+    edges.add(0, 1, 4);
+    edges.add(1, 2, -2);
+    edges.add(0, 2, 3);
+    JohnsonSolver solver(WideCSRGraph::from_edges(edges, true));
+    
+    std::vector<std::vector<long long>> result = solver.solve();
+    assert(!result.empty());
+    assert(result[0][2] == 2);
+    
+    solver.add_edge(2, 0, -3);
+    assert(solver.solve().empty());
+    
+    std::cout << "test_from_csr: OK" << std::endl;
+}
+
+void test_graph_file_roundtrip() {
+    EdgeList edges(3);
+    edges.add(0, 1, 4);
+    edges.add(1, 2, -2);
+    edges.add(0, 2, 3);
+    
+    std::string path = (std::filesystem::temp_directory_path() / "task_04_graph_file_test.bin").string();
+    save_graph_file(path.c_str(), WideCSRGraph::from_edges(edges, true));
+    WideCSRGraph loaded = load_graph_file<int64_t>(path.c_str(), true, true);
+    std::filesystem::remove(path);
+    
+    assert(loaded.directed());
+    assert(loaded.vertex_count() == 3);
+    assert(loaded.arc_count() == 3);
+    
+    JohnsonSolver solver(loaded);
+    std::vector<std::vector<long long>> result = solver.solve();
+    assert(!result.empty());
+    assert(result[0][2] == 2);
+    
+    // файл с 32-битными весами читается в 64-битный граф
+    save_graph_file(path.c_str(), BasicCSRGraph<uint32_t, int32_t>::from_edges(edges, true));
+    loaded = load_graph_file<int64_t>(path.c_str(), true, true);
+    std::filesystem::remove(path);
+    assert(loaded.weights()[0] == 4);
+    
+    // файл другой задачи: без весов или неориентированный
+    auto rejects = [&](const EdgeList& other, bool directed) {
+        save_graph_file(path.c_str(), WideCSRGraph::from_edges(other, directed));
+        bool thrown = false;
+        try {
+            load_graph_file<int64_t>(path.c_str(), true, true);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        std::filesystem::remove(path);
+        return thrown;
+    };
+    EdgeList unweighted(3);
+    unweighted.add(0, 1);
+    assert(rejects(unweighted, true));
+    assert(rejects(edges, false));
+    
+    std::cout << "test_graph_file_roundtrip: OK" << std::endl;
+}
+
+void test_graph_file_corrupted() {
+    EdgeList edges(3);
+    edges.add(0, 1, 4);
+    edges.add(1, 2, -2);
+    edges.add(0, 2, 3);
+    std::string path = (std::filesystem::temp_directory_path() / "task_04_graph_file_corrupt.bin").string();
+    
+    // записывает файл, портит одно 32-битное слово и пробует загрузить
+    auto loads_after = [&](auto section, int index, uint32_t value) {
+        save_graph_file(path.c_str(), WideCSRGraph::from_edges(edges, true));
+        GraphFileHeader header;
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekp(header.*section + index * sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        file.close();
+        bool loaded = true;
+        try {
+            load_graph_file<int64_t>(path.c_str(), true, true);
+        } catch (const std::runtime_error&) {
+            loaded = false;
+        }
+        std::filesystem::remove(path);
+        return loaded;
+    };
+    assert(loads_after(&GraphFileHeader::targets_pos, 0, 1));
+    assert(!loads_after(&GraphFileHeader::targets_pos, 1, 3));
+    assert(!loads_after(&GraphFileHeader::offsets_pos, 0, 1));
+    assert(!loads_after(&GraphFileHeader::offsets_pos, 1, 4));
+    assert(!loads_after(&GraphFileHeader::offsets_pos, 3, 2));
+    
+    std::cout << "test_graph_file_corrupted: OK" << std::endl;
+}
+
+void test_weights_exceed_int() {
+    // вес ребра не помещается в 32 бита при любой сборке CSRGraph
+    JohnsonSolver solver(3);
+    solver.add_edge(0, 1, 5000000000LL);
+    solver.add_edge(1, 2, -4000000000LL);
+    
+    std::vector<std::vector<long long>> result = solver.solve();
+    assert(!result.empty());
+    assert(result[0][1] == 5000000000LL);
+    assert(result[0][2] == 1000000000LL);
+    
+    std::cout << "test_weights_exceed_int: OK" << std::endl;
+}
+
+void test_arena_reuse() {
+    Arena arena(256);
+    JohnsonSolver solver(4, &arena);
+    solver.add_edge(0, 1, 3);
+    solver.add_edge(1, 2, -2);
+    solver.add_edge(2, 3, 2);
+    solver.add_edge(0, 3, 5);
+    
+    std::vector<std::vector<long long>> first = solver.solve();
+    size_t capacity = arena.capacity();
+    assert(capacity > 0);
+    assert(arena.used_bytes() == 0);
+    
+    // повторные вызовы используют уже выделенную арене память
+    for (int i = 0; i < 10; ++i) {
+        assert(solver.solve() == first);
+    }
+    assert(arena.capacity() == capacity);
+    assert(first[0][3] == 3);
+    
+    std::cout << "test_arena_reuse: OK" << std::endl;
+}
+
 int main() {
     test_simple_graph();
     test_negative_weights();
@@ -169,5 +311,10 @@ int main() {
     test_multiple_edges();
     test_complete_graph();
     test_chain_graph();
+    test_from_csr();
+    test_graph_file_roundtrip();
+    test_weights_exceed_int();
+    test_graph_file_corrupted();
+    test_arena_reuse();
     return 0;
 }
\ No newline at end of file
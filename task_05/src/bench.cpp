@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include "bench_alloc.hpp"
+#include "constrained_mst.h"
+#include "graph_generators.hpp"
+
+enum Family { kRandom, kGrid };
+
+static const char* family_name(int family) {
+    static const char* names[] = {"random", "grid"};
+    return names[family];
+}
+
+static EdgeList make_graph(int family, int n) {
+    EdgeList edges;
+    if (family == kRandom) {
+        edges = random_graph(n, 4LL * n, 42);
+    } else {
+        int side = std::sqrt(n);
+        edges = grid_graph(side, side);
+    }
+    assign_random_weights(edges, 1, 1000000, 7);
+    return edges;
+}
+
+static void BM_FindConstrainedMST(benchmark::State& state) {
+    EdgeList edges = make_graph(state.range(1), state.range(0));
+    int max_degree = state.range(2);
+    ConstrainedMST solver(CSRGraph::from_edges(edges, false), max_degree);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(solver.find_constrained_mst());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * edges.size());
+    state.SetLabel(family_name(state.range(1)));
+}
+
+BENCHMARK(BM_FindConstrainedMST)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid}, {2, 4}});
+
+BENCHMARK_MAIN();
@@ -5,13 +5,25 @@
 #include <functional>
 
 ConstrainedMST::ConstrainedMST(int vertices, int max_degree) : n(vertices), d(max_degree) {
-    adj.resize(n);
 }
 
-void ConstrainedMST::add_edge(int u, int v, int w) {
+ConstrainedMST::ConstrainedMST(const CSRGraph& graph, int max_degree)
+    : n(graph.vertex_count()), d(max_degree) {
+    // неориентированное ребро лежит в CSR дважды, берём дугу u < v
+    edges.reserve(graph.directed() ? graph.arc_count() : graph.arc_count() / 2);
+    for (int u = 0; u < n; ++u) {
+        auto targets = graph.neighbors(u);
+        auto weights = graph.neighbor_weights(u);
+        for (size_t i = 0; i < targets.size(); ++i) {
+            if (graph.directed() || u < static_cast<int>(targets[i])) {
+                edges.push_back(Edge(u, targets[i], weights[i]));
+            }
+        }
+    }
+}
+
+void ConstrainedMST::add_edge(int u, int v, long long w) {
     edges.push_back(Edge(u, v, w));
-    adj[u].push_back(edges.size() - 1);
-    adj[v].push_back(edges.size() - 1);
 }
 
 int ConstrainedMST::find_set(int v, std::vector<int>& parent) {
@@ -59,10 +71,12 @@ bool ConstrainedMST::can_add_edge(const Edge& edge, const std::vector<bool>& in_
     return true;
 }
 
-bool ConstrainedMST::kruskal_with_degree_limit(std::vector<Edge>& result, int& total_weight) {
+bool ConstrainedMST::kruskal_with_degree_limit(std::vector<Edge>& result, long long& total_weight) {
+    STATS_CLOCK(stats);
     std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
         return a.weight < b.weight;
     });
+    STATS_LAP("sort");
     
     std::vector<int> parent(n);
     std::vector<int> rank(n, 0);
@@ -75,10 +89,12 @@ bool ConstrainedMST::kruskal_with_degree_limit(std::vector<Edge>& result, int& t
     result.clear();
     total_weight = 0;
     int edges_added = 0;
+    STATS_ONLY(uint64_t considered = 0;)
     
     for (const auto& edge : edges) {
         if (edges_added == n - 1)
             break;
+        STATS_ONLY(++considered;)
         
         if (can_add_edge(edge, in_tree, degree, parent)) {
             int u = edge.u;
@@ -97,6 +113,11 @@ bool ConstrainedMST::kruskal_with_degree_limit(std::vector<Edge>& result, int& t
         }
     }
     
+    STATS_LAP("kruskal");
+    STATS_ADD(stats, "edges_considered", considered);
+    STATS_ADD(stats, "edges_rejected", considered - edges_added);
+    STATS_ADD(stats, "edges_added", edges_added);
+    
     if (edges_added != n - 1) {
         return false;
     }
@@ -110,9 +131,9 @@ bool ConstrainedMST::kruskal_with_degree_limit(std::vector<Edge>& result, int& t
     return true;
 }
 
-int ConstrainedMST::find_constrained_mst() {
+long long ConstrainedMST::find_constrained_mst() {
     std::vector<Edge> mst_edges;
-    int total_weight;
+    long long total_weight;
     
     if (kruskal_with_degree_limit(mst_edges, total_weight)) {
         return total_weight;
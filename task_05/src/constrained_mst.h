@@ -3,10 +3,13 @@
 
 #include <vector>
 #include <limits>
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
 
 struct Edge {
-    int u, v, weight;
-    Edge(int u, int v, int w) : u(u), v(v), weight(w) {}
+    int u, v;
+    long long weight;
+    Edge(int u, int v, long long w) : u(u), v(v), weight(w) {}
 };
 
 class ConstrainedMST {
@@ -14,19 +17,21 @@ private:
     int n;
     int d;
     std::vector<Edge> edges;
-    std::vector<std::vector<int>> adj;
+    SolverStats stats{"constrained_mst"};
     
     int find_set(int v, std::vector<int>& parent);
     void union_sets(int a, int b, std::vector<int>& parent, std::vector<int>& rank);
-    bool kruskal_with_degree_limit(std::vector<Edge>& result, int& total_weight);
+    bool kruskal_with_degree_limit(std::vector<Edge>& result, long long& total_weight);
     int degree_in_tree(int v, const std::vector<bool>& in_tree, const std::vector<Edge>& tree_edges);
     bool can_add_edge(const Edge& edge, const std::vector<bool>& in_tree, 
                       const std::vector<int>& degree, const std::vector<int>& parent);
     
 public:
     ConstrainedMST(int vertices, int max_degree);
-    void add_edge(int u, int v, int w);
-    int find_constrained_mst();
+    ConstrainedMST(const CSRGraph& graph, int max_degree);
+    void add_edge(int u, int v, long long w);
+    long long find_constrained_mst();
+    SolverStats get_stats() const { return stats; }
 };
 
 #endif
\ No newline at end of file
@@ -1,25 +1,47 @@
-#include <iostream>
 #include "constrained_mst.h"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "graph_file.hpp"
+#include "driver_args.hpp"
 
-int main() {
-    int n, m, d;
-    std::cin >> n >> m >> d;
+int main(int argc, char* argv[]) {
+    FastReader in;
+    FastWriter out;
+    // --graph <file>: граф из бинарного файла (tools/graph_convert), на входе остаётся только d
+    DriverArgs args(argc, argv);
+    if (args.graph_path) {
+        int d = in.read_int();
+        ConstrainedMST mst_solver(load_graph_file(args.graph_path, false, true), d);
+        long long result = mst_solver.find_constrained_mst();
+        if (result == -1) {
+            out << "Невозможно построить остовное дерев" << '\n';
+        } else {
+            out << result << '\n';
+        }
+        args.dump_stats(mst_solver.get_stats());
+        return 0;
+    }
+    
+    int n = in.read_int();
+    int m = in.read_int();
+    int d = in.read_int();
     
     ConstrainedMST mst_solver(n, d);
     
+    EdgeList edges = read_edge_list(in, n, m, true, args.threads);
     for (int i = 0; i < m; ++i) {
-        int u, v, w;
-        std::cin >> u >> v >> w;
-        mst_solver.add_edge(u - 1, v - 1, w);
+        mst_solver.add_edge(edges.from[i], edges.to[i], edges.weights[i]);
     }
     
-    int result = mst_solver.find_constrained_mst();
+    long long result = mst_solver.find_constrained_mst();
     
     if (result == -1) {
-        std::cout << "Невозможно построить остовное дерев" << std::endl;
+        out << "Невозможно построить остовное дерев" << '\n';
     } else {
-        std::cout << result << std::endl;
+        out << result << '\n';
     }
     
+    args.dump_stats(mst_solver.get_stats());
     return 0;
 }
\ No newline at end of file
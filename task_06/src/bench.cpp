@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include "bench_alloc.hpp"
+#include "max_flow.h"
+#include "graph_generators.hpp"
+
+enum Family { kRandom, kGrid };
+
+static const char* family_name(int family) {
+    static const char* names[] = {"random", "grid"};
+    return names[family];
+}
+
+static EdgeList make_network(int family, int n) {
+    EdgeList edges;
+    if (family == kRandom) {
+        edges = random_graph(n, 4LL * n, 42);
+    } else {
+        int side = std::sqrt(n);
+        edges = grid_graph(side, side);
+    }
+    assign_random_weights(edges, 1, 1000, 7);
+    return edges;
+}
+
+static void BM_MaxFlow(benchmark::State& state) {
+    EdgeList edges = make_network(state.range(1), state.range(0));
+    MaxFlowSolver solver(WideCSRGraph::from_edges(edges, true));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(solver.max_flow(0, edges.n - 1));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (edges.n + edges.size()));
+    state.SetLabel(family_name(state.range(1)));
+}
+
+BENCHMARK(BM_MaxFlow)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandom, kGrid}});
+
+BENCHMARK_MAIN();
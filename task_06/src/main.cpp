@@ -1,24 +1,35 @@
-#include <iostream>
 #include "max_flow.h"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "graph_file.hpp"
+#include "driver_args.hpp"
 
-int main() {
-    int n, m;
-    std::cin >> n >> m;
+WideCSRGraph read_network(unsigned threads) {
+    FastReader in;
+    int n = in.read_int();
+    int m = in.read_int();
     
-    MaxFlowSolver solver(n);
+    EdgeList edges = read_edge_list(in, n, m, true, threads);
+    return WideCSRGraph::from_edges(edges, true, false, threads);
+}
+
+int main(int argc, char* argv[]) {
+    FastWriter out;
+    // --graph <file>: сеть из бинарного файла (tools/graph_convert), без разбора текста
+    DriverArgs args(argc, argv);
+    WideCSRGraph network = args.graph_path ? load_graph_file<int64_t>(args.graph_path, true, true) : read_network(args.threads);
+    int n = network.vertex_count();
     
-    for (int i = 0; i < m; ++i) {
-        int u, v, c;
-        std::cin >> u >> v >> c;
-        solver.add_edge(u - 1, v - 1, c);
-    }
+    MaxFlowSolver solver(network);
     
     int source = 0;
     int sink = n - 1;
     
-    int max_flow = solver.max_flow(source, sink);
+    long long max_flow = solver.max_flow(source, sink);
     
-    std::cout << max_flow << std::endl;
+    out << max_flow << '\n';
     
+    args.dump_stats(solver.get_stats());
     return 0;
 }
\ No newline at end of file
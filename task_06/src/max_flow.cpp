@@ -1,55 +1,115 @@
 #include "max_flow.h"
 
-MaxFlowSolver::MaxFlowSolver(int vertices) : n(vertices) {
-    adj.resize(n);
+MaxFlowSolver::MaxFlowSolver(int vertices) : n(vertices), edges(vertices), residual_dirty(true) {
     level.resize(n);
     ptr.resize(n);
 }
 
-void MaxFlowSolver::add_edge(int from, int to, int capacity) {
-    Edge forward(to, capacity, adj[to].size());
-    Edge backward(from, 0, adj[from].size());
+MaxFlowSolver::MaxFlowSolver(const WideCSRGraph& graph)
+    : n(graph.vertex_count()), edges(graph.vertex_count()), residual_dirty(true) {
+    level.resize(n);
+    ptr.resize(n);
+    edges.reserve(graph.arc_count());
+    for (int u = 0; u < n; ++u) {
+        auto targets = graph.neighbors(u);
+        auto capacities = graph.neighbor_weights(u);
+        for (size_t i = 0; i < targets.size(); ++i) {
+            edges.add(u, targets[i], capacities[i]);
+        }
+    }
+}
+
+void MaxFlowSolver::add_edge(int from, int to, long long capacity) {
+    edges.add(from, to, capacity);
+    residual_dirty = true;
+}
+
+void MaxFlowSolver::build_residual() {
+    STATS_PHASE(stats, "build_residual");
+    if (!residual_dirty) {
+        std::fill(arc_flow.begin(), arc_flow.end(), 0);
+        return;
+    }
+    
+    residual = WideCSRGraph::from_edges(edges, false, true);
+    int arcs = residual.arc_count();
+    arc_capacity.assign(arcs, 0);
+    arc_flow.assign(arcs, 0);
+    arc_rev.assign(arcs, -1);
     
-    adj[from].push_back(forward);
-    adj[to].push_back(backward);
+    std::vector<int> forward(edges.size(), -1);
+    std::vector<int> backward(edges.size(), -1);
+    auto ids = residual.edge_ids();
+    for (int v = 0; v < n; ++v) {
+        for (int i = residual.offsets()[v], end = residual.offsets()[v + 1]; i < end; ++i) {
+            int e = ids[i];
+            if (v == edges.from[e] && forward[e] == -1) {
+                forward[e] = i;
+            } else {
+                backward[e] = i;
+            }
+        }
+    }
+    
+    for (int e = 0; e < edges.size(); ++e) {
+        arc_capacity[forward[e]] = edges.weights[e];
+        arc_rev[forward[e]] = backward[e];
+        arc_rev[backward[e]] = forward[e];
+    }
+    
+    residual_dirty = false;
 }
 
 bool MaxFlowSolver::bfs(int source, int sink) {
+    STATS_PHASE(stats, "bfs");
+    STATS_ADD(stats, "bfs_phases", 1);
     std::fill(level.begin(), level.end(), -1);
     std::queue<int> q;
     
     level[source] = 0;
     q.push(source);
     
+    auto offsets = residual.offsets();
+    auto targets = residual.targets();
+    STATS_ONLY(uint64_t arcs = 0;)
+    
     while (!q.empty()) {
         int v = q.front();
         q.pop();
         
-        for (const Edge& edge : adj[v]) {
-            if (level[edge.to] == -1 && edge.flow < edge.capacity) {
-                level[edge.to] = level[v] + 1;
-                q.push(edge.to);
+        STATS_ONLY(arcs += offsets[v + 1] - offsets[v];)
+        for (int i = offsets[v], end = offsets[v + 1]; i < end; ++i) {
+            int to = targets[i];
+            if (level[to] == -1 && arc_flow[i] < arc_capacity[i]) {
+                level[to] = level[v] + 1;
+                q.push(to);
             }
         }
     }
     
+    STATS_ADD(stats, "bfs_arcs", arcs);
     return level[sink] != -1;
 }
 
-int MaxFlowSolver::dfs(int v, int sink, int pushed) {
+WideCSRGraph::weight_type MaxFlowSolver::dfs(int v, int sink, WideCSRGraph::weight_type pushed) {
     if (pushed == 0) return 0;
     if (v == sink) return pushed;
     
-    for (int& i = ptr[v]; i < (int)adj[v].size(); ++i) {
-        Edge& edge = adj[v][i];
+    auto offsets = residual.offsets();
+    auto targets = residual.targets();
+    
+    int end = offsets[v + 1];
+    for (int& i = ptr[v]; i < end; ++i) {
+        int to = targets[i];
+        STATS_ONLY(++dfs_arcs;)
         
-        if (level[edge.to] == level[v] + 1 && edge.flow < edge.capacity) {
-            int min_capacity = std::min(pushed, edge.capacity - edge.flow);
-            int tr = dfs(edge.to, sink, min_capacity);
+        if (level[to] == level[v] + 1 && arc_flow[i] < arc_capacity[i]) {
+            WideCSRGraph::weight_type min_capacity = std::min(pushed, arc_capacity[i] - arc_flow[i]);
+            WideCSRGraph::weight_type tr = dfs(to, sink, min_capacity);
             
             if (tr > 0) {
-                edge.flow += tr;
-                adj[edge.to][edge.rev].flow -= tr;
+                arc_flow[i] += tr;
+                arc_flow[arc_rev[i]] -= tr;
                 return tr;
             }
         }
@@ -58,16 +118,23 @@ int MaxFlowSolver::dfs(int v, int sink, int pushed) {
     return 0;
 }
 
-int MaxFlowSolver::max_flow(int source, int sink) {
-    int flow = 0;
+long long MaxFlowSolver::max_flow(int source, int sink) {
+    build_residual();
+    long long flow = 0;
+    
+    STATS_ONLY(dfs_arcs = 0; uint64_t paths = 0;)
     
     while (bfs(source, sink)) {
-        std::fill(ptr.begin(), ptr.end(), 0);
+        STATS_PHASE(stats, "blocking_flow");
+        std::copy(residual.offsets().begin(), residual.offsets().end() - 1, ptr.begin());
         
-        while (int pushed = dfs(source, sink, std::numeric_limits<int>::max())) {
+        while (WideCSRGraph::weight_type pushed = dfs(source, sink, std::numeric_limits<WideCSRGraph::weight_type>::max())) {
             flow += pushed;
+            STATS_ONLY(++paths;)
         }
     }
+    STATS_ADD(stats, "augmenting_paths", paths);
+    STATS_ADD(stats, "dfs_arcs", dfs_arcs);
     
     return flow;
-}
\ No newline at end of file
+}
@@ -5,31 +5,36 @@
 #include <queue>
 #include <algorithm>
 #include <limits>
+#include "csr_graph.hpp"
+#include "solver_stats.hpp"
 
 class MaxFlowSolver {
 private:
-    struct Edge {
-        int to;
-        int capacity;
-        int flow;
-        int rev;
-        
-        Edge(int to, int capacity, int rev) 
-            : to(to), capacity(capacity), flow(0), rev(rev) {}
-    };
-    
     int n;
-    std::vector<std::vector<Edge>> adj;
+    EdgeList edges;
+    // остаточная сеть: дуга и обратная к ней лежат в одном CSR
+    WideCSRGraph residual;
+    // пропускные способности 64-битные при любой ширине CSRGraph: отдельная
+    // дуга может не поместиться в 32 бита, суммарный поток — тем более
+    std::vector<WideCSRGraph::weight_type> arc_capacity;
+    std::vector<WideCSRGraph::weight_type> arc_flow;
+    std::vector<int> arc_rev;
+    bool residual_dirty;
     std::vector<int> level;
     std::vector<int> ptr;
+    SolverStats stats{"dinic"};
+    STATS_ONLY(uint64_t dfs_arcs = 0;)
     
+    void build_residual();
     bool bfs(int source, int sink);
-    int dfs(int v, int sink, int flow);
+    WideCSRGraph::weight_type dfs(int v, int sink, WideCSRGraph::weight_type flow);
     
 public:
     MaxFlowSolver(int vertices);
-    void add_edge(int from, int to, int capacity);
-    int max_flow(int source, int sink);
+    MaxFlowSolver(const WideCSRGraph& graph);
+    void add_edge(int from, int to, long long capacity);
+    long long max_flow(int source, int sink);
+    SolverStats get_stats() const { return stats; }
 };
 
-#endif
\ No newline at end of file
+#endif
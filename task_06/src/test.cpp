@@ -10,8 +10,9 @@ void test_simple_graph() {
     solver.add_edge(1, 3, 3);
     solver.add_edge(2, 3, 2);
     
+    // из 0 выходит 5, и разрез {0} насыщается
     int flow = solver.max_flow(0, 3);
-    assert(flow == 4);
+    assert(flow == 5);
     std::cout << " OK" << std::endl;
 }
 
@@ -122,6 +123,41 @@ void test_large_flow() {
     std::cout << "OK" << std::endl;
 }
 
+void test_from_csr() {
+    EdgeList edges(4);
+    edges.add(0, 1, 3);
+    edges.add(0, 2, 2);
+    edges.add(1, 3, 2);
+    edges.add(2, 3, 3);
+    MaxFlowSolver solver(WideCSRGraph::from_edges(edges, true));
+    
+    assert(solver.max_flow(0, 3) == 4);
+    assert(solver.max_flow(0, 3) == 4);
+    solver.add_edge(1, 2, 1);
+    assert(solver.max_flow(0, 3) == 5);
+    std::cout << "test_from_csr: OK" << std::endl;
+}
+
+void test_flow_exceeds_int() {
+    // каждая дуга помещается в 32 бита, а суммарный поток — нет
+    MaxFlowSolver solver(4);
+    solver.add_edge(0, 1, 2000000000);
+    solver.add_edge(0, 2, 2000000000);
+    solver.add_edge(1, 3, 2000000000);
+    solver.add_edge(2, 3, 2000000000);
+    assert(solver.max_flow(0, 3) == 4000000000LL);
+    
+    // и отдельная дуга больше int
+    MaxFlowSolver wide(WideCSRGraph::from_edges([] {
+        EdgeList edges(3);
+        edges.add(0, 1, 5000000000LL);
+        edges.add(1, 2, 7000000000LL);
+        return edges;
+    }(), true));
+    assert(wide.max_flow(0, 2) == 5000000000LL);
+    std::cout << "test_flow_exceeds_int: OK" << std::endl;
+}
+
 int main() {
     test_simple_graph();
     test_single_edge();
@@ -133,6 +169,8 @@ int main() {
     test_parallel_edges();
     test_zero_capacity();
     test_large_flow();
+    test_from_csr();
+    test_flow_exceeds_int();
     
     std::cout << "test passed" << std::endl;
     return 0;
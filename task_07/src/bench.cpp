@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include "bench_alloc.hpp"
+#include "segment_tree.h"
+
+static std::vector<int> make_array(int n) {
+    std::mt19937 rng(42);
+    std::vector<int> arr(n);
+    for (int& x : arr) {
+        x = rng();
+    }
+    return arr;
+}
+
+// range(1) — доля обновлений в процентах
+static void BM_MixedQueries(benchmark::State& state) {
+    int n = state.range(0);
+    int update_percent = state.range(1);
+    SegmentTree seg_tree(make_array(n));
+    
+    const int kQueries = 1 << 12;
+    std::mt19937 rng(7);
+    std::vector<int> type(kQueries), a(kQueries), b(kQueries);
+    for (int i = 0; i < kQueries; ++i) {
+        type[i] = static_cast<int>(rng() % 100) < update_percent ? 2 : 1;
+        a[i] = rng() % n;
+        b[i] = type[i] == 2 ? static_cast<int>(rng()) : a[i] + rng() % (n - a[i]);
+    }
+    
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            for (int i = 0; i < kQueries; ++i) {
+                if (type[i] == 1) {
+                    benchmark::DoNotOptimize(seg_tree.range_min(a[i], b[i]));
+                } else {
+                    seg_tree.update_value(a[i], b[i]);
+                }
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+static void BM_Build(benchmark::State& state) {
+    std::vector<int> arr = make_array(state.range(0));
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            SegmentTree seg_tree(arr);
+            benchmark::DoNotOptimize(seg_tree);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * arr.size());
+}
+
+BENCHMARK(BM_MixedQueries)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 20, 8), {0, 10, 50}});
+BENCHMARK(BM_Build)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -1,32 +1,37 @@
-#include <iostream>
 #include <vector>
 #include "segment_tree.h"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "driver_args.hpp"
 
-int main() {
-    int n, q;
-    std::cin >> n >> q;
+int main(int argc, char* argv[]) {
+    DriverArgs args(argc, argv);
+    FastReader in;
+    FastWriter out;
+    int n = in.read_int();
+    int q = in.read_int();
     
     std::vector<int> arr(n);
     for (int i = 0; i < n; ++i) {
-        std::cin >> arr[i];
+        arr[i] = in.read_int();
     }
     
     SegmentTree seg_tree(arr);
     
     for (int i = 0; i < q; ++i) {
-        int type;
-        std::cin >> type;
+        int type = in.read_int();
         
         if (type == 1) {
-            int l, r;
-            std::cin >> l >> r;
-            std::cout << seg_tree.range_min(l - 1, r - 1) << std::endl;
+            int l = in.read_int();
+            int r = in.read_int();
+            out << seg_tree.range_min(l - 1, r - 1) << '\n';
         } else if (type == 2) {
-            int idx, val;
-            std::cin >> idx >> val;
+            int idx = in.read_int();
+            int val = in.read_int();
             seg_tree.update_value(idx - 1, val);
         }
     }
     
+    args.dump_stats(seg_tree.get_stats());
     return 0;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "segment_tree.h"
 
 SegmentTree::SegmentTree(const std::vector<int>& nums) {
+    STATS_PHASE(stats, "build");
     n = nums.size();
     arr = nums;
     tree.resize(4 * n);
@@ -20,6 +21,7 @@ void SegmentTree::build(int node, int left, int right) {
 }
 
 void SegmentTree::update(int node, int left, int right, int index, int value) {
+    STATS_ONLY(++update_nodes;)
     if (left == right) {
         tree[node] = value;
         arr[left] = value;
@@ -37,6 +39,7 @@ void SegmentTree::update(int node, int left, int right, int index, int value) {
 }
 
 int SegmentTree::query(int node, int left, int right, int ql, int qr) {
+    STATS_ONLY(++query_nodes;)
     if (ql > right || qr < left) {
         return INT_MAX;
     }
@@ -52,9 +55,20 @@ int SegmentTree::query(int node, int left, int right, int ql, int qr) {
 }
 
 void SegmentTree::update_value(int index, int value) {
+    STATS_ONLY(++updates;)
     update(1, 0, n - 1, index, value);
 }
 
 int SegmentTree::range_min(int left, int right) {
+    STATS_ONLY(++queries;)
     return query(1, 0, n - 1, left, right);
-}
\ No newline at end of file
+}
+
+SolverStats SegmentTree::get_stats() const {
+    SolverStats result = stats;
+    STATS_ADD(result, "queries", queries);
+    STATS_ADD(result, "query_nodes", query_nodes);
+    STATS_ADD(result, "updates", updates);
+    STATS_ADD(result, "update_nodes", update_nodes);
+    return result;
+}
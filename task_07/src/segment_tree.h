@@ -4,12 +4,16 @@
 #include <vector>
 #include <algorithm>
 #include <climits>
+#include "solver_stats.hpp"
 
 class SegmentTree {
 private:
     int n;
     std::vector<int> tree;
     std::vector<int> arr;
+    SolverStats stats{"segment_tree"};
+    // узлы, пройденные запросами и обновлениями
+    STATS_ONLY(uint64_t query_nodes = 0; uint64_t update_nodes = 0; uint64_t queries = 0; uint64_t updates = 0;)
     
     void build(int node, int left, int right);
     void update(int node, int left, int right, int index, int value);
@@ -19,6 +23,7 @@ public:
     SegmentTree(const std::vector<int>& nums);
     void update_value(int index, int value);
     int range_min(int left, int right);
+    SolverStats get_stats() const;
 };
 
 #endif
\ No newline at end of file
@@ -112,7 +112,7 @@ void test_edge_cases() {
     assert(seg_tree.range_min(2, 4) == -100);
     seg_tree.update_value(1, 1000);
     assert(seg_tree.range_min(0, 4) == -100);
-    assert(seg_tree.range_min(0, 1) == INT_MAX);
+    assert(seg_tree.range_min(0, 1) == 1000);
     
     std::cout << " OK" << std::endl;
 }
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include "bench_alloc.hpp"
+#include "lca.h"
+#include "graph_generators.hpp"
+
+enum Family { kRandomTree, kChain };
+
+static const char* family_name(int family) {
+    static const char* names[] = {"random_tree", "chain"};
+    return names[family];
+}
+
+static void BM_FindLCA(benchmark::State& state) {
+    int n = state.range(0);
+    EdgeList edges = state.range(1) == kRandomTree ? random_tree(n, 42) : chain_graph(n);
+    LCAFinder finder(CSRGraph::from_edges(edges, false));
+    finder.build(0);
+    
+    const int kQueries = 1 << 12;
+    std::mt19937 rng(7);
+    std::vector<int> u(kQueries), v(kQueries);
+    for (int i = 0; i < kQueries; ++i) {
+        u[i] = rng() % n;
+        v[i] = rng() % n;
+    }
+    
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            for (int i = 0; i < kQueries; ++i) {
+                benchmark::DoNotOptimize(finder.find_lca(u[i], v[i]));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+    state.SetLabel(family_name(state.range(1)));
+}
+
+static void BM_Build(benchmark::State& state) {
+    int n = state.range(0);
+    CSRGraph tree = CSRGraph::from_edges(state.range(1) == kRandomTree ? random_tree(n, 42) : chain_graph(n), false);
+    {
+        AllocationCounter alloc(state);
+        for (auto _ : state) {
+            LCAFinder finder(tree);
+            finder.build(0);
+            benchmark::DoNotOptimize(finder);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetLabel(family_name(state.range(1)));
+}
+
+BENCHMARK(BM_FindLCA)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandomTree, kChain}});
+BENCHMARK(BM_Build)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 16, 4), {kRandomTree, kChain}});
+
+BENCHMARK_MAIN();
@@ -1,51 +1,67 @@
 #include "lca.h"
 #include <algorithm>
 
-LCAFinder::LCAFinder(int vertices) : n(vertices) {
-    adj.resize(n);
+LCAFinder::LCAFinder(int vertices) : n(vertices), edges(vertices) {
     log_n = log2(n) + 1;
-    up.resize(n, std::vector<int>(log_n + 1));
+    up.resize(n * (log_n + 1));
     depth.resize(n);
     parent.resize(n, -1);
 }
 
+LCAFinder::LCAFinder(const CSRGraph& tree) : LCAFinder(tree.vertex_count()) {
+    adj = tree;
+}
+
 void LCAFinder::add_edge(int u, int v) {
-    adj[u].push_back(v);
-    adj[v].push_back(u);
+    edges.add(u, v);
 }
 
-void LCAFinder::dfs(int v, int p) {
+void LCAFinder::enter(int v, int p) {
     parent[v] = p;
     depth[v] = (p == -1) ? 0 : depth[p] + 1;
     
-    up[v][0] = p;
+    jump(v, 0) = p;
     for (int i = 1; i <= log_n; ++i) {
-        if (up[v][i-1] != -1) {
-            up[v][i] = up[up[v][i-1]][i-1];
+        if (jump(v, i - 1) != -1) {
+            jump(v, i) = jump(jump(v, i - 1), i - 1);
         } else {
-            up[v][i] = -1;
-        }
-    }
-    
-    for (int to : adj[v]) {
-        if (to != p) {
-            dfs(to, v);
+            jump(v, i) = -1;
         }
     }
 }
 
 void LCAFinder::preprocess() {
-    for (int i = 0; i < n; ++i) {
-        std::fill(up[i].begin(), up[i].end(), -1);
+    STATS_PHASE(stats, "preprocess");
+    if (!edges.empty() || adj.vertex_count() != n) {
+        // рёбра, добавленные через add_edge, дополняют переданное дерево
+        for (int u = 0; u < adj.vertex_count(); ++u) {
+            for (int v : adj.neighbors(u)) {
+                if (u < v) edges.add(u, v);
+            }
+        }
+        adj = CSRGraph::from_edges(edges, false);
+        edges.clear();
     }
+    std::fill(up.begin(), up.end(), -1);
 }
 
 void LCAFinder::build(int root) {
     preprocess();
-    dfs(root, -1);
+
+    struct Visitor : DfsVisitor {
+        LCAFinder& lca;
+        explicit Visitor(LCAFinder& finder) : lca(finder) {}
+        void enter(int v, int p) { lca.enter(v, p); }
+    };
+
+    STATS_PHASE(stats, "dfs");
+    Visitor visitor(*this);
+    dfs.reset(n);
+    dfs.run(adj, root, visitor);
 }
 
 int LCAFinder::find_lca(int u, int v) {
+    STATS_ONLY(++queries;)
     if (depth[u] < depth[v]) {
         std::swap(u, v);
     }
@@ -53,7 +69,8 @@ int LCAFinder::find_lca(int u, int v) {
     int diff = depth[u] - depth[v];
     for (int i = log_n; i >= 0; --i) {
         if (diff & (1 << i)) {
-            u = up[u][i];
+            STATS_ONLY(++jumps;)
+            u = jump(u, i);
         }
     }
     
@@ -62,9 +79,10 @@ int LCAFinder::find_lca(int u, int v) {
     }
     
     for (int i = log_n; i >= 0; --i) {
-        if (up[u][i] != up[v][i]) {
-            u = up[u][i];
-            v = up[v][i];
+        if (jump(u, i) != jump(v, i)) {
+            STATS_ONLY(++jumps;)
+            u = jump(u, i);
+            v = jump(v, i);
         }
     }
     
@@ -73,4 +91,11 @@ int LCAFinder::find_lca(int u, int v) {
 
 int LCAFinder::get_depth(int v) {
     return depth[v];
-}
\ No newline at end of file
+}
+
+SolverStats LCAFinder::get_stats() const {
+    SolverStats result = stats;
+    STATS_ADD(result, "queries", queries);
+    STATS_ADD(result, "jumps", jumps);
+    return result;
+}
@@ -3,25 +3,36 @@
 
 #include <vector>
 #include <cmath>
+#include "csr_graph.hpp"
+#include "dfs.hpp"
+#include "solver_stats.hpp"
 
 class LCAFinder {
 private:
     int n;
     int log_n;
-    std::vector<std::vector<int>> adj;
-    std::vector<std::vector<int>> up;
+    EdgeList edges;
+    CSRGraph adj;
+    // up[v * (log_n + 1) + i] - предок v на 2^i уровней выше
+    std::vector<int> up;
     std::vector<int> depth;
     std::vector<int> parent;
+    DfsEngine dfs;
+    SolverStats stats{"lca_binary_lifting"};
+    STATS_ONLY(uint64_t queries = 0; uint64_t jumps = 0;)
     
-    void dfs(int v, int p);
+    int& jump(int v, int i) { return up[v * (log_n + 1) + i]; }
+    void enter(int v, int p);
     void preprocess();
     
 public:
     LCAFinder(int vertices);
+    LCAFinder(const CSRGraph& tree);
     void add_edge(int u, int v);
     void build(int root = 0);
     int find_lca(int u, int v);
     int get_depth(int v);
+    SolverStats get_stats() const;
 };
 
-#endif
\ No newline at end of file
+#endif
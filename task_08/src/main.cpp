@@ -1,25 +1,37 @@
-#include <iostream>
 #include "lca.h"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "fast_writer.hpp"
+#include "graph_file.hpp"
+#include "driver_args.hpp"
 
-int main() {
-    int n, m;
-    std::cin >> n >> m;
-    
-    LCAFinder lca_finder(n);
-    
-    for (int i = 0; i < n - 1; ++i) {
-        int u, v;
-        std::cin >> u >> v;
-        lca_finder.add_edge(u - 1, v - 1);
+int main(int argc, char* argv[]) {
+    FastReader in;
+    FastWriter out;
+    // --graph <file>: дерево из бинарного файла (tools/graph_convert), на входе остаются m и запросы
+    DriverArgs args(argc, argv);
+    CSRGraph tree;
+    int m = 0;
+    if (args.graph_path) {
+        tree = load_graph_file(args.graph_path, false, false);
+        m = in.read_int();
+    } else {
+        int n = in.read_int();
+        m = in.read_int();
+        
+        EdgeList edges = read_edge_list(in, n, n - 1, false, args.threads);
+        tree = CSRGraph::from_edges(edges, false, false, args.threads);
     }
     
+    LCAFinder lca_finder(tree);
     lca_finder.build(0);
     
     for (int i = 0; i < m; ++i) {
-        int u, v;
-        std::cin >> u >> v;
-        std::cout << lca_finder.find_lca(u - 1, v - 1) + 1 << std::endl;
+        int u = in.read_int();
+        int v = in.read_int();
+        out << lca_finder.find_lca(u - 1, v - 1) + 1 << '\n';
     }
     
+    args.dump_stats(lca_finder.get_stats());
     return 0;
 }
\ No newline at end of file
@@ -187,6 +187,34 @@ void test_random_queries() {
     
 }
 
+void test_from_csr() {
+    EdgeList edges(5);
+    edges.add(0, 1);
+    edges.add(0, 2);
+    edges.add(2, 3);
+    LCAFinder finder(CSRGraph::from_edges(edges, false));
+    finder.add_edge(2, 4);
+    
+    finder.build(0);
+    
+    assert(finder.find_lca(3, 4) == 2);
+    assert(finder.find_lca(1, 4) == 0);
+    assert(finder.get_depth(4) == 2);
+}
+
+void test_deep_chain() {
+    const int n = 200000;
+    LCAFinder finder(n);
+    for (int i = 1; i < n; ++i) {
+        finder.add_edge(i - 1, i);
+    }
+    
+    finder.build(0);
+    
+    assert(finder.get_depth(n - 1) == n - 1);
+    assert(finder.find_lca(n - 1, 12345) == 12345);
+}
+
 int main() {
     test_simple_tree();
     test_chain_tree();
@@ -198,6 +226,8 @@ int main() {
     test_parent_child();
     test_different_root();
     test_random_queries();
+    test_from_csr();
+    test_deep_chain();
     
     std::cout << "test pass" << std::endl;
     return 0;
@@ -0,0 +1,71 @@
+#include <cstdio>
+#include <cstring>
+#include <exception>
+
+#include "csr_graph.hpp"
+#include "edge_normalize.hpp"
+#include "edge_reader.hpp"
+#include "fast_reader.hpp"
+#include "graph_file.hpp"
+#include "parallel.hpp"
+
+// Формат входа task_XX/tests/*.in для каждой задачи с графом.
+struct TaskFormat {
+    const char* task;
+    int header_values;  // n, m и дополнительные параметры в первой строке
+    bool directed;
+    bool weighted;
+    bool tree;          // рёбер n - 1, дальше идут запросы
+    bool simple;        // петли и кратные рёбра удаляются, как в драйвере
+    bool wide;          // драйвер читает 64-битные веса (WideCSRGraph)
+};
+
+static const TaskFormat kFormats[] = {
+    {"task_01", 2, false, false, false, true, false},
+    {"task_02", 2, true, false, false, false, false},
+    {"task_03", 2, true, false, false, false, false},
+    {"task_04", 2, true, true, false, false, true},
+    {"task_05", 3, false, true, false, false, false},
+    {"task_06", 2, true, true, false, false, true},
+    {"task_08", 2, false, false, true, false, false},
+};
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::fprintf(stderr, "usage: %s <task_XX> <input.in> <output.bin>\n", argv[0]);
+        return 2;
+    }
+
+    const TaskFormat* format = nullptr;
+    for (const TaskFormat& f : kFormats) {
+        if (std::strcmp(f.task, argv[1]) == 0) format = &f;
+    }
+    if (format == nullptr) {
+        std::fprintf(stderr, "%s has no graph input\n", argv[1]);
+        return 2;
+    }
+
+    FastReader in(argv[2]);
+    int n = in.read_int();
+    int m = in.read_int();
+    for (int i = 2; i < format->header_values; ++i) {
+        in.read_long();
+    }
+    if (format->tree) m = n - 1;
+
+    unsigned threads = default_thread_count();
+    EdgeList edges = read_edge_list(in, n, m, format->weighted, threads);
+    if (format->simple) normalize_undirected(edges);
+
+    try {
+        if (format->wide) {
+            save_graph_file(argv[3], WideCSRGraph::from_edges(edges, format->directed, false, threads));
+        } else {
+            save_graph_file(argv[3], CSRGraph::from_edges(edges, format->directed, false, threads));
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
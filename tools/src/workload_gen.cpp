@@ -0,0 +1,175 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+#include "edge_list.hpp"
+#include "fast_writer.hpp"
+#include "graph_generators.hpp"
+
+// Генерирует вход задачи task_XX в формате её README. Один и тот же набор
+// параметров (включая seed) всегда даёт один и тот же файл.
+struct Options {
+    std::string_view task;
+    std::string_view family;
+    int n = 1000;
+    long long m = -1;
+    uint64_t seed = 1;
+    int width = 32;
+    int d = 3;
+    long long queries = -1;
+    double update_ratio = 0.5;
+    long long wmin = 1;
+    long long wmax = 1000;
+};
+
+static void usage(const char* name) {
+    std::fprintf(stderr,
+                 "usage: %s <task_XX> [--family random|rmat|dag|grid|chain|tree|caterpillar|network]\n"
+                 "       [--n N] [--m M] [--seed S] [--width W] [--d D] [--queries Q]\n"
+                 "       [--update-ratio R] [--wmin W] [--wmax W]\n",
+                 name);
+}
+
+static bool parse(int argc, char* argv[], Options& opt) {
+    if (argc < 2) return false;
+    opt.task = argv[1];
+    for (int i = 2; i < argc; ++i) {
+        std::string_view key = argv[i];
+        if (i + 1 >= argc) return false;
+        const char* value = argv[++i];
+        if (key == "--family") {
+            opt.family = value;
+        } else if (key == "--n") {
+            opt.n = std::atoi(value);
+        } else if (key == "--m") {
+            opt.m = std::atoll(value);
+        } else if (key == "--seed") {
+            opt.seed = std::strtoull(value, nullptr, 10);
+        } else if (key == "--width") {
+            opt.width = std::atoi(value);
+        } else if (key == "--d") {
+            opt.d = std::atoi(value);
+        } else if (key == "--queries") {
+            opt.queries = std::atoll(value);
+        } else if (key == "--update-ratio") {
+            opt.update_ratio = std::atof(value);
+        } else if (key == "--wmin") {
+            opt.wmin = std::atoll(value);
+        } else if (key == "--wmax") {
+            opt.wmax = std::atoll(value);
+        } else {
+            return false;
+        }
+    }
+    if (opt.n < 1) return false;
+    if (opt.m < 0) opt.m = 4LL * opt.n;
+    if (opt.queries < 0) opt.queries = opt.n;
+    return true;
+}
+
+// Граф нужного семейства; n может уменьшиться (решётка берёт rows * cols вершин).
+static bool make_graph(const Options& opt, EdgeList& edges) {
+    std::string_view family = opt.family;
+    if (family == "random") {
+        edges = random_graph(opt.n, opt.m, opt.seed);
+    } else if (family == "rmat") {
+        edges = rmat_graph(opt.n, opt.m, opt.seed);
+    } else if (family == "dag") {
+        edges = layered_dag(opt.n, opt.width, opt.m, opt.seed);
+    } else if (family == "grid") {
+        int rows = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(opt.n))));
+        edges = grid_graph(rows, opt.n / rows);
+    } else if (family == "chain") {
+        edges = chain_graph(opt.n);
+    } else if (family == "tree") {
+        edges = random_tree(opt.n, opt.seed);
+    } else if (family == "caterpillar") {
+        edges = caterpillar_tree(opt.n, std::max(1, opt.n / 2), opt.seed);
+    } else if (family == "network") {
+        edges = layered_network(opt.n, opt.width, opt.m, opt.seed);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static void write_edges(FastWriter& out, const EdgeList& edges) {
+    for (int i = 0; i < edges.size(); ++i) {
+        out << edges.from[i] + 1 << ' ' << edges.to[i] + 1;
+        if (edges.weighted()) out << ' ' << edges.weights[i];
+        out << '\n';
+    }
+}
+
+static void write_rmq(FastWriter& out, const Options& opt) {
+    std::mt19937_64 rng(opt.seed);
+    out << opt.n << ' ' << opt.queries << '\n';
+    for (int i = 0; i < opt.n; ++i) {
+        out << static_cast<int>(static_cast<uint32_t>(rng()) >> 1) - (1 << 30) << (i + 1 < opt.n ? ' ' : '\n');
+    }
+    RmqQueryStream stream(opt.n, opt.update_ratio, opt.seed + 1);
+    for (long long i = 0; i < opt.queries; ++i) {
+        RmqQueryStream::Query q = stream.next();
+        if (q.type == 1) {
+            out << "1 " << q.l + 1 << ' ' << q.r + 1 << '\n';
+        } else {
+            out << "2 " << q.l + 1 << ' ' << q.r << '\n';
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    if (!parse(argc, argv, opt)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    FastWriter out;
+    if (opt.task == "task_07") {
+        write_rmq(out, opt);
+        return 0;
+    }
+
+    bool tree_task = opt.task == "task_08";
+    if (opt.family.empty()) {
+        opt.family = tree_task ? "tree" : opt.task == "task_06" ? "network" : opt.task == "task_03" ? "dag" : "random";
+    }
+    if (tree_task && opt.family != "tree" && opt.family != "chain" && opt.family != "caterpillar") {
+        std::fprintf(stderr, "task_08 needs a tree family: tree, chain or caterpillar\n");
+        return 2;
+    }
+
+    EdgeList edges;
+    if (!make_graph(opt, edges)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (opt.task == "task_01" || opt.task == "task_02" || opt.task == "task_03") {
+        out << edges.n << ' ' << edges.size() << '\n';
+    } else if (opt.task == "task_04" || opt.task == "task_06") {
+        assign_random_weights(edges, opt.wmin, opt.wmax, opt.seed + 1);
+        out << edges.n << ' ' << edges.size() << '\n';
+    } else if (opt.task == "task_05") {
+        assign_random_weights(edges, opt.wmin, opt.wmax, opt.seed + 1);
+        out << edges.n << ' ' << edges.size() << ' ' << opt.d << '\n';
+    } else if (tree_task) {
+        out << edges.n << ' ' << opt.queries << '\n';
+        write_edges(out, edges);
+        PairQueryStream stream(edges.n, opt.seed + 1);
+        for (long long i = 0; i < opt.queries; ++i) {
+            auto [u, v] = stream.next();
+            out << u + 1 << ' ' << v + 1 << '\n';
+        }
+        return 0;
+    } else {
+        std::fprintf(stderr, "unknown task %s\n", argv[1]);
+        return 2;
+    }
+    write_edges(out, edges);
+    return 0;
+}